@@ -0,0 +1,83 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "adaptive-periodic-sync.hpp"
+
+#include <algorithm>
+
+namespace ndn::svs {
+
+AdaptivePeriodicSync::AdaptivePeriodicSync(time::milliseconds interval,
+                                           time::milliseconds minInterval,
+                                           time::milliseconds maxInterval,
+                                           time::steady_clock::time_point now)
+  : m_baseInterval(std::clamp(interval, minInterval, std::max(minInterval, maxInterval)))
+  , m_minInterval(minInterval)
+  , m_maxInterval(std::max(minInterval, maxInterval))
+  , m_interval(m_baseInterval)
+  , m_periodStart(now)
+{
+}
+
+void
+AdaptivePeriodicSync::onStateChanged()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stateChanged = true;
+}
+
+void
+AdaptivePeriodicSync::onStateDiverged()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stateDiverged = true;
+}
+
+time::milliseconds
+AdaptivePeriodicSync::nextInterval(time::steady_clock::time_point now)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (now - m_periodStart < m_interval)
+    return m_interval;
+
+  if (m_stateDiverged) {
+    // Recover faster from loss
+    m_interval = std::max(m_interval / 2, m_minInterval);
+  } else if (!m_stateChanged) {
+    // Nothing happened; back off slowly
+    m_interval = std::min(m_interval * 3 / 2, m_maxInterval);
+  } else if (m_interval < m_baseInterval) {
+    m_interval = std::min(m_interval * 2, m_baseInterval);
+  } else {
+    m_interval = m_baseInterval;
+  }
+
+  m_periodStart = now;
+  m_stateChanged = false;
+  m_stateDiverged = false;
+  return m_interval;
+}
+
+time::milliseconds
+AdaptivePeriodicSync::getInterval() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_interval;
+}
+
+} // namespace ndn::svs
@@ -0,0 +1,84 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_ADAPTIVE_PERIODIC_SYNC_HPP
+#define NDN_SVS_ADAPTIVE_PERIODIC_SYNC_HPP
+
+#include "common.hpp"
+
+#include <mutex>
+
+namespace ndn::svs {
+
+/**
+ * @brief Periodic sync interval adapted to the consistency of the group
+ *
+ * Periodic sync interests only serve to recover state lost in the network.
+ * The interval is adjusted once per interval: it is halved when a peer was
+ * found to be missing state during the last interval, which indicates a
+ * lossy network, and stretched when no new state was seen at all, so that
+ * idle groups send fewer interests. Otherwise it returns to the base value.
+ *
+ * All methods are thread-safe.
+ */
+class AdaptivePeriodicSync : noncopyable
+{
+public:
+  /**
+   * @param interval base periodic sync interval
+   * @param minInterval lower bound of the interval
+   * @param maxInterval upper bound of the interval
+   */
+  AdaptivePeriodicSync(time::milliseconds interval,
+                       time::milliseconds minInterval,
+                       time::milliseconds maxInterval,
+                       time::steady_clock::time_point now = time::steady_clock::now());
+
+  /// @brief Record that new state was published or learned
+  void onStateChanged();
+
+  /// @brief Record that a peer was missing state known locally
+  void onStateDiverged();
+
+  /**
+   * @brief Get the interval until the next periodic sync interest
+   *
+   * If the current interval has elapsed since the last adjustment,
+   * the interval is adjusted to the events recorded since then.
+   */
+  time::milliseconds nextInterval(time::steady_clock::time_point now = time::steady_clock::now());
+
+  /// @brief Current periodic sync interval
+  time::milliseconds getInterval() const;
+
+private:
+  const time::milliseconds m_baseInterval;
+  const time::milliseconds m_minInterval;
+  const time::milliseconds m_maxInterval;
+
+  time::milliseconds m_interval;
+  // Start of the current adjustment period
+  time::steady_clock::time_point m_periodStart;
+  // Events within the current adjustment period
+  bool m_stateChanged = false;
+  bool m_stateDiverged = false;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_ADAPTIVE_PERIODIC_SYNC_HPP
@@ -0,0 +1,111 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "adaptive-suppression.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn::svs {
+
+// More replies than this to one outdated vector widen the window
+static constexpr size_t MAX_GOOD_REPLIES = 2;
+// Multiplicative window changes on too many and on a single reply
+static constexpr double WINDOW_INCREASE = 1.25;
+static constexpr double WINDOW_DECREASE = 0.95;
+// Lower bound of the suppression window in milliseconds
+static constexpr double MIN_WINDOW = 10;
+
+AdaptiveSuppression::AdaptiveSuppression(time::milliseconds initialWindow,
+                                         time::milliseconds maxWindow,
+                                         time::milliseconds activityWindow)
+  : m_maxWindow(maxWindow)
+  , m_activityWindow(activityWindow)
+  , m_window(std::min(initialWindow, maxWindow).count())
+{
+}
+
+void
+AdaptiveSuppression::onNodeActive(NodeHandle handle, time::steady_clock::time_point now)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lastActive[handle] = now;
+}
+
+void
+AdaptiveSuppression::forget(NodeHandle handle)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lastActive.erase(handle);
+}
+
+void
+AdaptiveSuppression::onSuppressionEnd(size_t nReplies)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (nReplies > MAX_GOOD_REPLIES)
+    m_window *= WINDOW_INCREASE;
+  else if (nReplies <= 1)
+    m_window *= WINDOW_DECREASE;
+
+  m_window = std::clamp(m_window, std::min(MIN_WINDOW, static_cast<double>(m_maxWindow.count())),
+                        static_cast<double>(m_maxWindow.count()));
+}
+
+size_t
+AdaptiveSuppression::getActiveNodes(time::steady_clock::time_point now)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (auto it = m_lastActive.begin(); it != m_lastActive.end();) {
+    if (now - it->second > m_activityWindow)
+      it = m_lastActive.erase(it);
+    else
+      ++it;
+  }
+
+  return std::max<size_t>(m_lastActive.size(), 1);
+}
+
+time::milliseconds
+AdaptiveSuppression::getWindow() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return time::milliseconds(static_cast<time::milliseconds::rep>(m_window));
+}
+
+double
+AdaptiveSuppression::curveFactorFor(size_t nActive)
+{
+  return std::max(1.0, 2.0 * std::log(static_cast<double>(nActive) + 1.0));
+}
+
+int
+AdaptiveSuppression::curve(int window, int value, double factor)
+{
+  // Increasing the curve factor makes the curve steeper =>
+  // better for more nodes, but worse for fewer nodes.
+  if (window <= 0)
+    return 0;
+
+  double c = window;
+  double v = value;
+  return static_cast<int>(c * (1.0 - std::exp((v - c) / (c / factor))));
+}
+
+} // namespace ndn::svs
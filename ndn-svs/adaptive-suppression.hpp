@@ -0,0 +1,117 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_ADAPTIVE_SUPPRESSION_HPP
+#define NDN_SVS_ADAPTIVE_SUPPRESSION_HPP
+
+#include "common.hpp"
+#include "node-id-registry.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ndn::svs {
+
+/**
+ * @brief Suppression timer parameters adapted to duplicate replies and active nodes
+ *
+ * When a node receives an outdated vector, it replies after a random delay
+ * within the suppression window, shaped by curve(). Steeper curves make it
+ * more likely that a single node replies first, which is better in large
+ * groups and slower in small ones, so the curve factor follows the number
+ * of recently active nodes. The window is widened when more replies than
+ * needed are observed during suppression, and narrowed slowly otherwise to
+ * reduce the delay of replies.
+ *
+ * All methods are thread-safe.
+ */
+class AdaptiveSuppression : noncopyable
+{
+public:
+  /**
+   * @param initialWindow suppression window until replies are observed
+   * @param maxWindow upper bound of the suppression window
+   * @param activityWindow nodes updated within this time are active
+   */
+  explicit AdaptiveSuppression(time::milliseconds initialWindow = 500_ms,
+                               time::milliseconds maxWindow = 2_s,
+                               time::milliseconds activityWindow = 30_s);
+
+  /// @brief Record that a node published new data
+  void onNodeActive(NodeHandle handle,
+                    time::steady_clock::time_point now = time::steady_clock::now());
+
+  /// @brief Forget a node, e.g. before its handle is released
+  void forget(NodeHandle handle);
+
+  /**
+   * @brief Record the end of a suppression period
+   * @param nReplies number of replies to the outdated vector, including our own
+   */
+  void onSuppressionEnd(size_t nReplies);
+
+  /// @brief Number of nodes active within the activity window, at least 1
+  size_t getActiveNodes(time::steady_clock::time_point now = time::steady_clock::now());
+
+  /// @brief Current suppression window
+  time::milliseconds getWindow() const;
+
+  /// @brief Current curve factor
+  double getCurveFactor(time::steady_clock::time_point now = time::steady_clock::now())
+  {
+    return curveFactorFor(getActiveNodes(now));
+  }
+
+public:
+  /**
+   * @brief Curve factor for a group with @p nActive active nodes
+   *
+   * The factor grows logarithmically, and is 10 (the fixed factor used
+   * without adaptation) for about 150 active nodes.
+   */
+  static double curveFactorFor(size_t nActive);
+
+  /**
+   * @brief Shape a uniformly distributed delay in [0, window]
+   *
+   * This curve increases the probability that only one or a few nodes
+   * pick lower values for timers compared to other nodes.
+   *
+   * @param window suppression window in milliseconds
+   * @param value uniformly distributed value in [0, window]
+   * @param factor curve factor; larger is steeper
+   */
+  static int curve(int window, int value, double factor);
+
+public:
+  /// @brief Curve factor used without adaptation
+  static constexpr double DEFAULT_CURVE_FACTOR = 10.0;
+
+private:
+  const time::milliseconds m_maxWindow;
+  const time::milliseconds m_activityWindow;
+
+  // Last activity of each node
+  std::unordered_map<NodeHandle, time::steady_clock::time_point> m_lastActive;
+  // Current suppression window in milliseconds
+  double m_window;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_ADAPTIVE_SUPPRESSION_HPP
@@ -0,0 +1,92 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "buffer-pool.hpp"
+
+#include <cstring>
+
+namespace ndn::svs {
+
+/**
+ * @brief Write a TLV VarNumber at @p pos
+ * @returns position after the VarNumber
+ */
+static uint8_t*
+writeVarNumber(uint8_t* pos, uint64_t number)
+{
+  size_t size = ndn::tlv::sizeOfVarNumber(number);
+  if (size == 1) {
+    *pos = static_cast<uint8_t>(number);
+    return pos + 1;
+  }
+
+  *pos++ = size == 3 ? 253 : size == 5 ? 254 : 255;
+  for (size_t i = size - 1; i > 0; i--) {
+    pos[i - 1] = static_cast<uint8_t>(number);
+    number >>= 8;
+  }
+  return pos + size - 1;
+}
+
+BufferPool::BufferPool(size_t maxBuffers)
+  : m_maxBuffers(maxBuffers)
+{
+  m_buffers.reserve(m_maxBuffers);
+}
+
+std::shared_ptr<Buffer>
+BufferPool::acquire(size_t size)
+{
+  // Buffers only referenced by the pool are free
+  for (const auto& buffer : m_buffers) {
+    if (buffer.use_count() == 1) {
+      buffer->resize(size);
+      return buffer;
+    }
+  }
+
+  auto buffer = std::make_shared<Buffer>(size);
+  if (m_buffers.size() < m_maxBuffers)
+    m_buffers.push_back(buffer);
+  return buffer;
+}
+
+Block
+BufferPool::encode(uint32_t type, std::initializer_list<const Block*> elements)
+{
+  size_t length = 0;
+  for (const auto* element : elements) {
+    if (element)
+      length += element->size();
+  }
+
+  auto buffer =
+    acquire(ndn::tlv::sizeOfVarNumber(type) + ndn::tlv::sizeOfVarNumber(length) + length);
+
+  uint8_t* pos = writeVarNumber(buffer->data(), type);
+  pos = writeVarNumber(pos, length);
+  for (const auto* element : elements) {
+    if (element) {
+      std::memcpy(pos, element->data(), element->size());
+      pos += element->size();
+    }
+  }
+
+  return Block(std::move(buffer));
+}
+
+} // namespace ndn::svs
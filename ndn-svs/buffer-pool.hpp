@@ -0,0 +1,60 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_BUFFER_POOL_HPP
+#define NDN_SVS_BUFFER_POOL_HPP
+
+#include "common.hpp"
+
+#include <initializer_list>
+
+namespace ndn::svs {
+
+/**
+ * @brief Pool of buffers to encode outgoing packets without allocation
+ *
+ * A buffer is reused once all Blocks referring to it are released, and
+ * keeps its capacity, so encoding packets of similar size at a steady
+ * rate allocates no memory once the pool is warm.
+ *
+ * This class is not thread-safe.
+ */
+class BufferPool : noncopyable
+{
+public:
+  /// @param maxBuffers maximum number of buffers kept for reuse
+  explicit BufferPool(size_t maxBuffers = 4);
+
+  /// @brief Get a buffer of @p size bytes that is not referenced elsewhere
+  std::shared_ptr<Buffer> acquire(size_t size);
+
+  /**
+   * @brief Encode a TLV element in a pooled buffer
+   *
+   * @param type TLV type of the element
+   * @param elements encoded blocks, concatenated as the value; null pointers are skipped
+   */
+  Block encode(uint32_t type, std::initializer_list<const Block*> elements);
+
+private:
+  const size_t m_maxBuffers;
+  std::vector<std::shared_ptr<Buffer>> m_buffers;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_BUFFER_POOL_HPP
@@ -0,0 +1,208 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "compact-state-vector.hpp"
+#include "compressor.hpp"
+#include "tlv.hpp"
+
+#include <limits>
+
+namespace ndn::svs {
+
+/**
+ * @brief Read one name component TLV at @p pos and advance past it
+ * @returns wire encoding of the component
+ */
+static span<const uint8_t>
+readComponent(const uint8_t*& pos, const uint8_t* end)
+{
+  const uint8_t* begin = pos;
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!ndn::tlv::readType(pos, end, type) || !ndn::tlv::readVarNumber(pos, end, length) ||
+      length > static_cast<uint64_t>(end - pos))
+    NDN_THROW(ndn::tlv::Error("Malformed name component in CompactStateVector"));
+
+  pos += length;
+  return span<const uint8_t>(begin, static_cast<size_t>(pos - begin));
+}
+
+/**
+ * @brief Account for @p size more bytes of expanded NodeIDs
+ *
+ * Every entry may repeat the whole previous NodeID, so the expansion is
+ * bounded like a decompressed payload rather than by the input size.
+ */
+static void
+addExpandedSize(size_t& expandedSize, size_t size)
+{
+  expandedSize += size;
+  if (expandedSize > Compressor::MAX_DECOMPRESSED_SIZE)
+    NDN_THROW(ndn::tlv::Error("CompactStateVector expands beyond the size limit"));
+}
+
+static uint64_t
+readNumber(const uint8_t*& pos, const uint8_t* end)
+{
+  uint64_t number = 0;
+  if (!ndn::tlv::readVarNumber(pos, end, number))
+    NDN_THROW(ndn::tlv::Error("Truncated CompactStateVector entry"));
+  return number;
+}
+
+ndn::Block
+encodeCompactStateVector(const StateVectorView& vv)
+{
+  struct CompactEntry
+  {
+    size_t sharedComponents;
+    span<const uint8_t> suffix;
+    SeqNo seqNo;
+  };
+
+  // Find the prefix shared with the previous entry
+  std::vector<CompactEntry> entries;
+  entries.reserve(vv.size());
+  span<const uint8_t> prev;
+  SeqNo base = std::numeric_limits<SeqNo>::max();
+
+  for (const auto& entry : vv) {
+    const uint8_t* prevPos = prev.data();
+    const uint8_t* prevEnd = prevPos + prev.size();
+    const uint8_t* pos = entry.nodeIdValue.data();
+    const uint8_t* end = pos + entry.nodeIdValue.size();
+    size_t shared = 0;
+
+    while (pos < end && prevPos < prevEnd) {
+      const uint8_t* compBegin = pos;
+      auto comp = readComponent(pos, end);
+      if (!StateVectorView::equalNodeId(comp, readComponent(prevPos, prevEnd))) {
+        pos = compBegin;
+        break;
+      }
+      shared++;
+    }
+
+    entries.push_back({ shared, span<const uint8_t>(pos, static_cast<size_t>(end - pos)), entry.seqNo });
+    prev = entry.nodeIdValue;
+    base = std::min(base, entry.seqNo);
+  }
+
+  ndn::encoding::EncodingBuffer enc;
+  size_t totalLength = 0;
+
+  // Sequence numbers of long-lived groups are large but close together,
+  // and take fewer octets as differences to the smallest one
+  for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+    totalLength += enc.prependVarNumber(it->seqNo - base);
+    totalLength += enc.prependBytes(it->suffix);
+    totalLength += enc.prependVarNumber(it->suffix.size());
+    totalLength += enc.prependVarNumber(it->sharedComponents);
+  }
+  if (!entries.empty())
+    totalLength += enc.prependVarNumber(base);
+
+  enc.prependVarNumber(totalLength);
+  enc.prependVarNumber(tlv::CompactStateVector);
+  return enc.block();
+}
+
+ndn::Block
+expandCompactStateVector(const ndn::Block& block)
+{
+  if (block.type() != tlv::CompactStateVector)
+    NDN_THROW(ndn::tlv::Error("CompactStateVector", block.type()));
+
+  struct ExpandedEntry
+  {
+    // Range of the NodeID in the component list
+    size_t offset;
+    size_t nComponents;
+    size_t nameLength;
+    SeqNo seqNo;
+  };
+
+  // Wire encodings of all components of all NodeIDs
+  std::vector<span<const uint8_t>> components;
+  std::vector<ExpandedEntry> entries;
+  size_t expandedSize = 0;
+
+  const uint8_t* pos = block.value();
+  const uint8_t* end = pos + block.value_size();
+  SeqNo base = pos < end ? readNumber(pos, end) : 0;
+
+  while (pos < end) {
+    uint64_t shared = readNumber(pos, end);
+    uint64_t suffixLength = readNumber(pos, end);
+    if (suffixLength > static_cast<uint64_t>(end - pos))
+      NDN_THROW(ndn::tlv::Error("Truncated CompactStateVector entry"));
+
+    ExpandedEntry entry{ components.size(), 0, 0, 0 };
+
+    // Shared prefix of the previous NodeID
+    if (shared > 0) {
+      if (entries.empty() || shared > entries.back().nComponents)
+        NDN_THROW(ndn::tlv::Error("Invalid shared prefix in CompactStateVector"));
+
+      size_t prevOffset = entries.back().offset;
+      for (size_t i = 0; i < shared; i++) {
+        components.push_back(components[prevOffset + i]);
+        entry.nameLength += components.back().size();
+        addExpandedSize(expandedSize, components.back().size());
+      }
+    }
+
+    // Suffix components
+    const uint8_t* suffixEnd = pos + suffixLength;
+    while (pos < suffixEnd) {
+      components.push_back(readComponent(pos, suffixEnd));
+      entry.nameLength += components.back().size();
+      addExpandedSize(expandedSize, components.back().size());
+    }
+
+    entry.nComponents = components.size() - entry.offset;
+    uint64_t delta = readNumber(pos, end);
+    if (delta > std::numeric_limits<SeqNo>::max() - base)
+      NDN_THROW(ndn::tlv::Error("Invalid SeqNo in CompactStateVector"));
+    entry.seqNo = base + delta;
+    entries.push_back(entry);
+  }
+
+  ndn::encoding::EncodingBuffer enc;
+  size_t totalLength = 0;
+
+  for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+    // SeqNo
+    size_t entryLength = ndn::encoding::prependNonNegativeIntegerBlock(enc, tlv::SeqNo, it->seqNo);
+
+    // NodeID (Name)
+    for (size_t i = it->nComponents; i > 0; i--)
+      entryLength += enc.prependBytes(components[it->offset + i - 1]);
+    entryLength += enc.prependVarNumber(it->nameLength);
+    entryLength += enc.prependVarNumber(ndn::tlv::Name);
+
+    totalLength += enc.prependVarNumber(entryLength);
+    totalLength += enc.prependVarNumber(tlv::StateVectorEntry);
+    totalLength += entryLength;
+  }
+
+  enc.prependVarNumber(totalLength);
+  enc.prependVarNumber(tlv::StateVector);
+  return enc.block();
+}
+
+} // namespace ndn::svs
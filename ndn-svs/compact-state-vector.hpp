@@ -0,0 +1,57 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_COMPACT_STATE_VECTOR_HPP
+#define NDN_SVS_COMPACT_STATE_VECTOR_HPP
+
+#include "common.hpp"
+#include "state-vector-view.hpp"
+
+namespace ndn::svs {
+
+/**
+ * @brief Encode a state vector in the compact format
+ *
+ * The CompactStateVector TLV-VALUE is the smallest sequence number of
+ * the vector, absent if it is empty, followed by a sequence of entries
+ *
+ *     BaseSeqNo (VarNumber)
+ *     *(SharedComponents (VarNumber)
+ *       SuffixLength (VarNumber)
+ *       *NameComponent (SuffixLength octets)
+ *       SeqNoDelta (VarNumber))
+ *
+ * where the NodeID is formed by the first SharedComponents components of
+ * the previous entry's NodeID followed by the suffix components, and the
+ * sequence number is BaseSeqNo + SeqNoDelta. Entries keep the order of
+ * @p vv, so sorted vectors share the longest prefixes.
+ */
+ndn::Block
+encodeCompactStateVector(const StateVectorView& vv);
+
+/**
+ * @brief Expand a CompactStateVector block into an equivalent StateVector block
+ *
+ * @throws ndn::tlv::Error the block is not a well-formed CompactStateVector,
+ *         or its NodeIDs expand to more than Compressor::MAX_DECOMPRESSED_SIZE
+ */
+ndn::Block
+expandCompactStateVector(const ndn::Block& block);
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_COMPACT_STATE_VECTOR_HPP
@@ -0,0 +1,201 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "compressor.hpp"
+#include "tlv.hpp"
+
+#include <ndn-cxx/encoding/buffer-stream.hpp>
+
+#ifdef NDN_SVS_COMPRESSION
+#include <array>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/filter/lzma.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#endif
+
+#ifdef NDN_SVS_HAVE_ZSTD
+#include <zdict.h>
+#include <zstd.h>
+#endif
+
+namespace ndn::svs {
+
+#ifdef NDN_SVS_COMPRESSION
+uint32_t
+LzmaCompressor::getType() const
+{
+  return tlv::LzmaBlock;
+}
+
+ndn::Block
+LzmaCompressor::compress(span<const uint8_t> input)
+{
+  boost::iostreams::filtering_istreambuf in;
+  in.push(boost::iostreams::lzma_compressor());
+  in.push(boost::iostreams::array_source(reinterpret_cast<const char*>(input.data()), input.size()));
+  ndn::OBufferStream compressed;
+  boost::iostreams::copy(in, compressed);
+  return ndn::Block(tlv::LzmaBlock, compressed.buf());
+}
+
+ndn::ConstBufferPtr
+LzmaCompressor::decompress(span<const uint8_t> input)
+{
+  try {
+    boost::iostreams::filtering_istreambuf in;
+    in.push(boost::iostreams::lzma_decompressor());
+    in.push(boost::iostreams::array_source(reinterpret_cast<const char*>(input.data()), input.size()));
+
+    // Inflate in chunks, so that an oversized stream is rejected as soon as it crosses the limit
+    auto decompressed = std::make_shared<ndn::Buffer>();
+    std::array<char, 4096> chunk;
+    std::streamsize n = 0;
+    while ((n = in.sgetn(chunk.data(), chunk.size())) > 0) {
+      if (decompressed->size() + static_cast<size_t>(n) > MAX_DECOMPRESSED_SIZE)
+        NDN_THROW(Error("LZMA decompressed size exceeds limit"));
+      decompressed->insert(decompressed->end(), chunk.begin(), chunk.begin() + n);
+    }
+    return decompressed;
+  } catch (const Error&) {
+    throw;
+  } catch (const std::exception&) {
+    NDN_THROW_NESTED(Error("LZMA decompression failed"));
+  }
+}
+#endif
+
+#ifdef NDN_SVS_HAVE_ZSTD
+class ZstdCompressor::Impl
+{
+public:
+  ~Impl()
+  {
+    ZSTD_freeCCtx(cctx);
+    ZSTD_freeDCtx(dctx);
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+  }
+
+public:
+  int level = 1;
+  ZSTD_CCtx* cctx = nullptr;
+  ZSTD_DCtx* dctx = nullptr;
+  ZSTD_CDict* cdict = nullptr;
+  ZSTD_DDict* ddict = nullptr;
+};
+
+ZstdCompressor::ZstdCompressor(int level, span<const uint8_t> dictionary)
+  : m_impl(std::make_unique<Impl>())
+{
+  m_impl->level = level;
+  m_impl->cctx = ZSTD_createCCtx();
+  m_impl->dctx = ZSTD_createDCtx();
+  if (m_impl->cctx == nullptr || m_impl->dctx == nullptr)
+    NDN_THROW(Error("Cannot allocate zstd contexts"));
+
+  if (!dictionary.empty()) {
+    m_impl->cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), level);
+    m_impl->ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+    if (m_impl->cdict == nullptr || m_impl->ddict == nullptr)
+      NDN_THROW(Error("Cannot load zstd dictionary"));
+  }
+}
+
+ZstdCompressor::~ZstdCompressor() = default;
+
+uint32_t
+ZstdCompressor::getType() const
+{
+  return tlv::ZstdBlock;
+}
+
+ndn::Block
+ZstdCompressor::compress(span<const uint8_t> input)
+{
+  auto buf = std::make_shared<ndn::Buffer>(ZSTD_compressBound(input.size()));
+
+  size_t size = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_impl->cdict != nullptr)
+      size = ZSTD_compress_usingCDict(
+        m_impl->cctx, buf->data(), buf->size(), input.data(), input.size(), m_impl->cdict);
+    else
+      size = ZSTD_compressCCtx(
+        m_impl->cctx, buf->data(), buf->size(), input.data(), input.size(), m_impl->level);
+  }
+
+  if (ZSTD_isError(size))
+    NDN_THROW(Error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size)));
+
+  buf->resize(size);
+  return ndn::Block(tlv::ZstdBlock, std::move(buf));
+}
+
+ndn::ConstBufferPtr
+ZstdCompressor::decompress(span<const uint8_t> input)
+{
+  // The frame header always carries the content size, see compress()
+  auto contentSize = ZSTD_getFrameContentSize(input.data(), input.size());
+  if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+      contentSize > MAX_DECOMPRESSED_SIZE)
+    NDN_THROW(Error("Invalid zstd frame header"));
+
+  auto buf = std::make_shared<ndn::Buffer>(static_cast<size_t>(contentSize));
+
+  size_t size = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_impl->ddict != nullptr)
+      size = ZSTD_decompress_usingDDict(
+        m_impl->dctx, buf->data(), buf->size(), input.data(), input.size(), m_impl->ddict);
+    else
+      size = ZSTD_decompressDCtx(m_impl->dctx, buf->data(), buf->size(), input.data(), input.size());
+  }
+
+  if (ZSTD_isError(size) || size != buf->size())
+    NDN_THROW(Error("zstd decompression failed"));
+
+  return buf;
+}
+
+ndn::Buffer
+ZstdCompressor::trainDictionary(const std::vector<ndn::Block>& samples, size_t maxSize)
+{
+  // ZDICT expects the samples concatenated in one buffer
+  ndn::Buffer concatenated;
+  std::vector<size_t> sizes;
+  sizes.reserve(samples.size());
+  for (const auto& sample : samples) {
+    concatenated.insert(concatenated.end(), sample.begin(), sample.end());
+    sizes.push_back(sample.size());
+  }
+
+  ndn::Buffer dictionary(maxSize);
+  size_t size = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), concatenated.data(),
+                                      sizes.data(), static_cast<unsigned>(sizes.size()));
+  if (ZDICT_isError(size))
+    NDN_THROW(Error(std::string("zstd dictionary training failed: ") + ZDICT_getErrorName(size)));
+
+  dictionary.resize(size);
+  return dictionary;
+}
+#endif
+
+} // namespace ndn::svs
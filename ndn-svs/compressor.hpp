@@ -0,0 +1,124 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_COMPRESSOR_HPP
+#define NDN_SVS_COMPRESSOR_HPP
+
+#include "common.hpp"
+
+#include <mutex>
+
+namespace ndn::svs {
+
+/**
+ * @brief Interface for compressing the parameters of sync interests
+ *
+ * The compressed parameters are carried in a single block of the type
+ * returned by getType(). All members of a sync group must use the same
+ * compressor (and dictionary, if any).
+ */
+class Compressor : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  virtual ~Compressor() = default;
+
+  /// @brief TLV type of the compressed block
+  virtual uint32_t getType() const = 0;
+
+  /// @brief Compress @p input into a block of type getType()
+  virtual ndn::Block compress(span<const uint8_t> input) = 0;
+
+  /**
+   * @brief Decompress the value of a compressed block
+   * @throws Error the input could not be decompressed
+   */
+  virtual ndn::ConstBufferPtr decompress(span<const uint8_t> input) = 0;
+
+public:
+  /// @brief Largest decompressed size accepted by decompress()
+  static constexpr size_t MAX_DECOMPRESSED_SIZE = 1 << 20;
+};
+
+#ifdef NDN_SVS_COMPRESSION
+/**
+ * @brief LZMA compressor producing LzmaBlock
+ *
+ * This is the original compression extension; it gives good ratios
+ * but is slow, since the filter chain is rebuilt for every interest.
+ */
+class LzmaCompressor : public Compressor
+{
+public:
+  uint32_t getType() const override;
+
+  ndn::Block compress(span<const uint8_t> input) override;
+
+  ndn::ConstBufferPtr decompress(span<const uint8_t> input) override;
+};
+#endif
+
+#ifdef NDN_SVS_HAVE_ZSTD
+/**
+ * @brief Zstandard compressor producing ZstdBlock
+ *
+ * The compression and decompression contexts are kept across calls.
+ * State vectors are small and repetitive, so a dictionary trained on
+ * sample vectors with trainDictionary() improves the ratio considerably.
+ */
+class ZstdCompressor : public Compressor
+{
+public:
+  /**
+   * @param level zstd compression level
+   * @param dictionary raw dictionary content, or empty for no dictionary
+   */
+  explicit ZstdCompressor(int level = 1, span<const uint8_t> dictionary = {});
+
+  ~ZstdCompressor() override;
+
+  uint32_t getType() const override;
+
+  ndn::Block compress(span<const uint8_t> input) override;
+
+  ndn::ConstBufferPtr decompress(span<const uint8_t> input) override;
+
+  /**
+   * @brief Train a dictionary from sample encodings, e.g. of state vectors
+   *
+   * @param samples wire encodings to train on; zstd needs at least a few
+   *        dozen samples to produce a useful dictionary
+   * @param maxSize maximum size of the dictionary
+   * @throws Error training failed
+   */
+  static ndn::Buffer trainDictionary(const std::vector<ndn::Block>& samples, size_t maxSize = 16384);
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+  std::mutex m_mutex;
+};
+#endif
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_COMPRESSOR_HPP
@@ -0,0 +1,61 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#include "congestion-window.hpp"
+
+#include <algorithm>
+
+namespace ndn::svs {
+
+CongestionWindow::CongestionWindow(const CongestionWindowOptions& options)
+  : m_options(options)
+  , m_window(options.initialWindow)
+  , m_ssthresh(options.slowStart ? options.maxWindow : options.initialWindow)
+{
+  if (m_options.minWindow < 1 || m_options.maxWindow < m_options.minWindow ||
+      m_options.initialWindow < m_options.minWindow || m_options.initialWindow > m_options.maxWindow ||
+      m_options.additiveIncrease <= 0 || m_options.multiplicativeDecrease <= 0 ||
+      m_options.multiplicativeDecrease >= 1)
+    NDN_THROW(Error("Invalid congestion window options"));
+}
+
+void
+CongestionWindow::onData(size_t nPending)
+{
+  if (nPending < getLimit())
+    return;
+
+  if (isSlowStart())
+    m_window += 1;
+  else
+    m_window += m_options.additiveIncrease / m_window;
+
+  m_window = std::min(m_window, m_options.maxWindow);
+}
+
+bool
+CongestionWindow::onCongestion(uint64_t id, uint64_t lastId)
+{
+  if (id <= m_recoveryPoint)
+    return false;
+
+  m_window = std::max(m_window * m_options.multiplicativeDecrease, m_options.minWindow);
+  m_ssthresh = m_window;
+  m_recoveryPoint = lastId;
+  return true;
+}
+
+} // namespace ndn::svs
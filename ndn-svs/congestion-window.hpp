@@ -0,0 +1,121 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#ifndef NDN_SVS_CONGESTION_WINDOW_HPP
+#define NDN_SVS_CONGESTION_WINDOW_HPP
+
+#include "common.hpp"
+
+namespace ndn::svs {
+
+/**
+ * @brief Options of an AIMD congestion window
+ */
+struct CongestionWindowOptions
+{
+  /// @brief Window at start, in interests
+  double initialWindow = 10;
+
+  /// @brief Lower bound of the window
+  double minWindow = 1;
+
+  /// @brief Upper bound of the window
+  double maxWindow = 1000;
+
+  /// @brief Increase of the window per round trip in congestion avoidance
+  double additiveIncrease = 1;
+
+  /// @brief Factor applied to the window on congestion, in (0, 1)
+  double multiplicativeDecrease = 0.5;
+
+  /**
+   * @brief Grow the window by one interest per Data until the first congestion.
+   *
+   * Otherwise the window only grows additively from the start.
+   */
+  bool slowStart = true;
+};
+
+/**
+ * @brief Additive-increase/multiplicative-decrease window of outstanding interests
+ *
+ * Interests are identified by increasing sequence numbers. The window is
+ * decreased at most once per round trip: losses of interests sent before
+ * the last decrease are part of the same congestion event. The window is
+ * not synchronized; callers must serialize access.
+ */
+class CongestionWindow
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @throws Error if the options are invalid
+   */
+  explicit CongestionWindow(const CongestionWindowOptions& options = {});
+
+  /**
+   * @brief Grow the window on a satisfied interest
+   *
+   * The window only grows while it is fully used, so that an application
+   * limited sender does not build up a window it never probed (RFC 7661).
+   *
+   * @param nPending interests outstanding when the Data arrived, including
+   *        the satisfied one
+   */
+  void onData(size_t nPending);
+
+  /**
+   * @brief Shrink the window on a timeout or congestion mark
+   * @param id sequence number of the lost interest
+   * @param lastId sequence number of the last interest sent
+   * @returns whether this is a new congestion event
+   */
+  bool onCongestion(uint64_t id, uint64_t lastId);
+
+  /// @brief Current window
+  double getWindow() const noexcept
+  {
+    return m_window;
+  }
+
+  /// @brief Number of interests that may be outstanding
+  size_t getLimit() const noexcept
+  {
+    return static_cast<size_t>(m_window);
+  }
+
+  /// @brief Whether the window is in slow start
+  bool isSlowStart() const noexcept
+  {
+    return m_window < m_ssthresh;
+  }
+
+private:
+  const CongestionWindowOptions m_options;
+  double m_window;
+  double m_ssthresh;
+  // Losses up to this interest belong to the last congestion event
+  uint64_t m_recoveryPoint = 0;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_CONGESTION_WINDOW_HPP
@@ -15,44 +15,142 @@
  */
 
 #include "core.hpp"
+#include "compact-state-vector.hpp"
 #include "tlv.hpp"
 
-#include <ndn-cxx/encoding/buffer-stream.hpp>
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/security/signing-helpers.hpp>
 #include <ndn-cxx/security/verification-helpers.hpp>
+#include <ndn-cxx/util/sha256.hpp>
 
-#include <chrono>
+#include <boost/asio/post.hpp>
 
-#ifdef NDN_SVS_COMPRESSION
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/filter/lzma.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#endif
+#include <chrono>
 
 namespace ndn::svs {
 
+/**
+ * @brief Upper bound of the encoding size of a fragment besides its entries
+ *
+ * Covers the TLV-TYPE and TLV-LENGTH of the ApplicationParameters, the
+ * StateVector and the fragment marker, the partial marker and the index.
+ * The bounding NodeID and the extra block are accounted separately.
+ */
+static constexpr size_t FRAGMENT_OVERHEAD = 4 + 4 + 4 + 2 + 10;
+
+/**
+ * @brief Decode the range of NodeIDs described by a fragment
+ *
+ * The first fragment is unbounded below, others begin at their first
+ * entry. The marker carries the exclusive end, except in the last fragment.
+ */
+static std::optional<SVSyncCore::FragmentRange>
+decodeFragmentRange(const Block& marker, const StateVectorView& vv)
+{
+  marker.parse();
+  SVSyncCore::FragmentRange range;
+
+  if (ndn::encoding::readNonNegativeInteger(marker.get(tlv::FragmentIndex)) > 0) {
+    if (vv.size() == 0)
+      return std::nullopt;
+    range.begin = vv.begin()->getNodeId();
+  }
+
+  if (auto end = marker.find(ndn::tlv::Name); end != marker.elements_end())
+    range.end = NodeID(*end);
+
+  return range;
+}
+
+/**
+ * @brief Get the key of a sync interest in the duplicate filter
+ *
+ * The ParametersSha256Digest covers the signature of v0.3 signed interests.
+ * The signature components of v0.2 signed interests follow the digest, and
+ * are hashed with it, so that copies of the same parameters signed by
+ * different nodes are told apart.
+ */
+static Name::Component
+getDuplicateKey(const Name& name)
+{
+  auto index = name.findParamsDigest();
+  if (index < 0 || static_cast<size_t>(index) + 1 == name.size())
+    return index < 0 ? Name::Component() : name.get(index);
+
+  auto wire = name.getSubName(index).wireEncode();
+  auto digest = ndn::util::Sha256::computeDigest({ wire.data(), wire.size() });
+  return Name::Component(ndn::tlv::ParametersSha256DigestComponent, *digest);
+}
+
 SVSyncCore::SVSyncCore(ndn::Face& face,
                        const Name& syncPrefix,
                        const UpdateCallback& onUpdate,
                        const SecurityOptions& securityOptions,
-                       const NodeID& nid)
+                       const NodeID& nid,
+                       const SyncCoreOptions& options)
+  : SVSyncCore(face, nullptr, syncPrefix, onUpdate, securityOptions, nid, options)
+{
+}
+
+SVSyncCore::SVSyncCore(ndn::Face& face,
+                       ndn::Scheduler* scheduler,
+                       const Name& syncPrefix,
+                       const UpdateCallback& onUpdate,
+                       const SecurityOptions& securityOptions,
+                       const NodeID& nid,
+                       const SyncCoreOptions& options)
   : m_face(face)
   , m_syncPrefix(syncPrefix)
   , m_securityOptions(securityOptions)
   , m_id(nid)
   , m_onUpdate(onUpdate)
-  , m_maxSuppressionTime(500_ms)
-  , m_periodicSyncTime(30_s)
-  , m_periodicSyncJitter(0.1)
+  , m_syncInterestName(Name(m_syncPrefix).appendVersion(SYNC_VERSION))
+  , m_compactSyncInterestName(Name(m_syncPrefix).appendVersion(SYNC_VERSION_COMPACT))
+  , m_nodeIdRegistry(std::make_shared<NodeIdRegistry>())
+  , m_maxSuppressionTime(options.maxSuppressionTime)
+  , m_periodicSyncTime(options.periodicSyncTime)
+  , m_periodicSyncJitter(options.periodicSyncJitter)
+  , m_inactiveMemberTimeout(options.inactiveMemberTimeout)
+  , m_tombstoneLifetime(options.tombstoneLifetime)
+  , m_nextPrune(time::system_clock::now() + m_inactiveMemberTimeout)
   , m_rng(ndn::random::getRandomNumberEngine())
   , m_retxDist(m_periodicSyncTime.count() * (1.0 - m_periodicSyncJitter),
                m_periodicSyncTime.count() * (1.0 + m_periodicSyncJitter))
   , m_intrReplyDist(0, m_maxSuppressionTime.count())
-  , m_keyChainMem("pib-memory:", "tpm-memory:")
-  , m_scheduler(m_face.getIoContext())
+  , m_ownScheduler(scheduler ? nullptr : std::make_unique<ndn::Scheduler>(m_face.getIoContext()))
+  , m_scheduler(scheduler ? *scheduler : *m_ownScheduler)
 {
+  if (m_maxSuppressionTime < 0_ms || m_periodicSyncTime <= 0_ms || m_periodicSyncJitter < 0 ||
+      m_periodicSyncJitter >= 1)
+    NDN_THROW(Error("Invalid sync timer options"));
+
+  // Tombstones must outlive the pruning of the same entries by peers
+  if (m_inactiveMemberTimeout < 0_ms || m_tombstoneLifetime < 0_ms ||
+      (m_inactiveMemberTimeout > 0_ms && m_tombstoneLifetime < m_inactiveMemberTimeout))
+    NDN_THROW(Error("Invalid pruning options"));
+
+  if (options.adaptivePeriodicSync) {
+    if (options.minPeriodicSyncTime <= 0_ms || options.minPeriodicSyncTime > options.maxPeriodicSyncTime)
+      NDN_THROW(Error("Invalid adaptive periodic sync bounds"));
+
+    m_adaptivePeriodicSync = std::make_unique<AdaptivePeriodicSync>(
+      m_periodicSyncTime, options.minPeriodicSyncTime, options.maxPeriodicSyncTime);
+  }
+
+  if (m_securityOptions.interestSigner->signingInfo.getSignerType() ==
+      security::SigningInfo::SIGNER_TYPE_HMAC)
+    m_hmacContext = std::make_unique<HmacContext>(m_securityOptions.interestSigner->signingInfo);
+
+  publishState();
+
+#ifdef NDN_SVS_COMPRESSION
+  m_compressor = std::make_shared<LzmaCompressor>();
+#endif
+
+  // Hosted cores receive sync interests from the manager
+  if (scheduler)
+    return;
+
   // Register sync interest filter
   m_syncRegisteredPrefix =
     m_face.setInterestFilter(syncPrefix,
@@ -61,28 +159,13 @@ SVSyncCore::SVSyncCore(ndn::Face& face,
                              [](auto&&...) { NDN_THROW(Error("Failed to register sync prefix")); });
 }
 
-static inline int
-suppressionCurve(int constFactor, int value)
-{
-  // This curve increases the probability that only one or a few
-  // nodes pick lower values for timers compared to other nodes.
-  // This leads to better suppression results.
-  // Increasing the curve factor makes the curve steeper =>
-  // better for more nodes, but worse for fewer nodes.
-
-  float c = constFactor;
-  float v = value;
-  float f = 10.0; // curve factor
-
-  return static_cast<int>(c * (1.0 - std::exp((v - c) / (c / f))));
-}
-
 void
 SVSyncCore::sendInitialInterest()
 {
   // Wait for 100ms before sending the first sync interest
-  // This is necessary to give other things time to initialize
-  m_scheduler.schedule(100_ms, [this] {
+  // This is necessary to give other things time to initialize.
+  // The scheduler of a hosted core outlives it, so the event is scoped.
+  m_packetEvent = m_scheduler.schedule(100_ms, [this] {
     m_initialized = true;
     retxSyncInterest(true, 0);
   });
@@ -90,26 +173,86 @@ SVSyncCore::sendInitialInterest()
 
 void
 SVSyncCore::onSyncInterest(const Interest& interest)
+{
+  // The filter is keyed by the digest component, which must match the
+  // parameters, or a forged copy could take the place of the genuine one
+  if (interest.hasApplicationParameters() && !interest.isParametersDigestValid())
+    return;
+
+  // Reject copies of recent interests before verifying and decoding them
+  if (m_duplicateFilter && interest.hasApplicationParameters()) {
+    if (m_duplicateFilter->isDuplicate(getDuplicateKey(interest.getName()))) {
+      m_nDuplicateHits++;
+
+      // Identical replies of other nodes still count towards the
+      // duplicate replies seen by adaptive suppression
+      std::lock_guard<std::mutex> lock(m_recordedVvMutex);
+      if (m_recordedVv)
+        m_suppressionReplies++;
+      return;
+    }
+    m_nDuplicateMisses++;
+  }
+
+  auto signerType = m_securityOptions.interestSigner->signingInfo.getSignerType();
+  bool isVerified = signerType == security::SigningInfo::SIGNER_TYPE_HMAC ||
+                    (signerType != security::SigningInfo::SIGNER_TYPE_NULL && m_securityOptions.validator);
+
+  if (!isVerified) {
+    onSyncInterestValidated(interest);
+    return;
+  }
+
+  // Validators are not thread-safe, so they only look up the key of the
+  // signer here; the signature is checked on the pool if they found one
+  bool isHmac = signerType == security::SigningInfo::SIGNER_TYPE_HMAC;
+  ConstBufferPtr key;
+  if (m_validationPool && !isHmac)
+    key = m_securityOptions.validator->getVerificationKey(interest);
+
+  if (!m_validationPool || (!isHmac && key == nullptr)) {
+    validateSyncInterest(interest, std::bind(&SVSyncCore::onSyncInterestValidated, this, _1));
+    return;
+  }
+
+  // Verify on the pool, and merge on the thread of the face. The pool is
+  // destroyed with this instance, so a live pool means a live instance.
+  std::weak_ptr<ValidationPool> pool = m_validationPool;
+  auto& io = m_face.getIoContext();
+  m_validationPool->post([this, pool, &io, interest, key] {
+    auto onValidated = [this, pool, &io](const Interest& validated) {
+      boost::asio::post(io, [this, pool, validated] {
+        if (!pool.expired())
+          onSyncInterestValidated(validated);
+      });
+    };
+
+    if (key == nullptr)
+      validateSyncInterest(interest, onValidated);
+    else if (security::verifySignature(interest, *key))
+      onValidated(interest);
+  });
+}
+
+void
+SVSyncCore::validateSyncInterest(const Interest& interest,
+                                 const std::function<void(const Interest&)>& onValidated)
 {
   switch (m_securityOptions.interestSigner->signingInfo.getSignerType()) {
     case security::SigningInfo::SIGNER_TYPE_NULL:
-      onSyncInterestValidated(interest);
+      onValidated(interest);
       return;
 
     case security::SigningInfo::SIGNER_TYPE_HMAC:
-      if (security::verifySignature(interest,
-                                    m_keyChainMem.getTpm(),
-                                    m_securityOptions.interestSigner->signingInfo.getSignerName(),
-                                    DigestAlgorithm::SHA256))
-        onSyncInterestValidated(interest);
+      if (m_hmacContext->verify(interest))
+        onValidated(interest);
       return;
 
     default:
       if (m_securityOptions.validator)
-        m_securityOptions.validator->validate(
-          interest, std::bind(&SVSyncCore::onSyncInterestValidated, this, _1), nullptr);
+        m_securityOptions.validator->validate(interest, onValidated, [](auto&&...) {});
       else
-        onSyncInterestValidated(interest);
+        onValidated(interest);
       return;
   }
 }
@@ -135,35 +278,48 @@ SVSyncCore::onSyncInterestValidated(const Interest& interest)
   ndn::Block params = interest.getApplicationParameters();
   params.parse();
 
-#ifdef NDN_SVS_COMPRESSION
-  // Decompress if necessary. The spec requires that if an LZMA block is
-  // present, then no other blocks are present (everything is compressed
-  // together)
-  if (params.find(tlv::LzmaBlock) != params.elements_end()) {
-    auto lzmaBlock = params.get(tlv::LzmaBlock);
-
-    boost::iostreams::filtering_istreambuf in;
-    in.push(boost::iostreams::lzma_decompressor());
-    in.push(boost::iostreams::array_source(reinterpret_cast<const char*>(lzmaBlock.value()),
-                                           lzmaBlock.value_size()));
-    ndn::OBufferStream decompressed;
-    boost::iostreams::copy(in, decompressed);
-
-    auto parsed = ndn::Block::fromBuffer(decompressed.buf());
-    if (!std::get<0>(parsed)) {
-      // TODO: log error parsing inner block
+  // Decompress if necessary. If a compressed block is present,
+  // then no other blocks are present (everything is compressed together)
+  auto compressed = params.find(tlv::LzmaBlock);
+  if (compressed == params.elements_end())
+    compressed = params.find(tlv::ZstdBlock);
+  if (compressed != params.elements_end()) {
+    auto compressor = findDecompressor(compressed->type());
+    if (compressor == nullptr) {
+      m_nDecompressionDrops++;
       return;
     }
 
-    params = std::get<1>(parsed);
-    params.parse();
+    try {
+      auto parsed = ndn::Block::fromBuffer(compressor->decompress(compressed->value_bytes()));
+      if (!std::get<0>(parsed)) {
+        m_nDecompressionDrops++;
+        return;
+      }
+
+      params = std::get<1>(parsed);
+      params.parse();
+    } catch (const std::exception&) {
+      m_nDecompressionDrops++;
+      return;
+    }
   }
-#endif
 
-  // Get state vector
-  std::shared_ptr<VersionVector> vvOther;
+  // The version component tells the state vector encoding
+  bool isCompact = false;
+  const auto& interestName = interest.getName();
+  if (interestName.size() > m_syncPrefix.size()) {
+    const auto& version = interestName.get(m_syncPrefix.size());
+    isCompact = version.isVersion() && version.toVersion() == SYNC_VERSION_COMPACT;
+  }
+
+  // Get state vector; entries are decoded lazily while merging
+  std::optional<StateVectorView> vvOther;
   try {
-    vvOther = std::make_shared<VersionVector>(params.get(tlv::StateVector));
+    if (isCompact)
+      vvOther.emplace(expandCompactStateVector(params.get(tlv::CompactStateVector)));
+    else
+      vvOther.emplace(params.get(tlv::StateVector));
   } catch (ndn::tlv::Error&) {
     // TODO: log error
     return;
@@ -178,18 +334,68 @@ SVSyncCore::onSyncInterestValidated(const Interest& interest)
     }
   }
 
+  // Partial vectors only carry recently updated entries
+  bool isPartial = params.find(tlv::PartialStateVector) != params.elements_end();
+
+  // Fragments of a full vector describe a range of NodeIDs completely
+  std::optional<FragmentRange> fragment;
+  if (auto marker = params.find(tlv::StateVectorFragment); isPartial && marker != params.elements_end()) {
+    try {
+      fragment = decodeFragmentRange(*marker, *vvOther);
+    } catch (ndn::tlv::Error&) {
+      // TODO: log error and merge as a partial vector
+    }
+  }
+
+  // If the incoming vector is identical to the local one, there is
+  // nothing to merge; compare digests to skip the merge in steady state
+  bool isIdentical = false;
+  if (!isPartial) {
+    auto vv = getState();
+    isIdentical = vvOther->size() == vv->size() && vvOther->getDigest() == vv->getDigest();
+
+    // Digests can collide, so merge in full every so often to repair
+    // any divergence a collision would otherwise hide forever
+    if (isIdentical && ++m_nDigestHitsSinceMerge > MAX_DIGEST_HITS_WITHOUT_MERGE)
+      isIdentical = false;
+    if (!isIdentical)
+      m_nDigestHitsSinceMerge = 0;
+  }
+
+  m_nSyncInterests++;
+  if (isIdentical)
+    m_nDigestHits++;
+
   // Merge state vector
-  auto result = mergeStateVector(*vvOther);
+  MergeResult result;
+  if (!isIdentical)
+    result = mergeStateVector(*vvOther, isPartial, fragment);
 
   // Callback if missing data found
   if (!result.missingInfo.empty()) {
-    for (auto& e : result.missingInfo)
+    auto now = time::steady_clock::now();
+    for (auto& e : result.missingInfo) {
       e.incomingFace = incomingFace;
+      if (m_adaptiveSuppression)
+        m_adaptiveSuppression->onNodeActive(e.nodeHandle, now);
+    }
     m_onUpdate(result.missingInfo);
   }
 
+  // The other node is missing local state; make sure our next
+  // sync interest carries the full vector
+  if (result.myVectorNew)
+    m_sendFullVector = true;
+
+  if (m_adaptivePeriodicSync) {
+    if (!result.missingInfo.empty())
+      m_adaptivePeriodicSync->onStateChanged();
+    if (result.myVectorNew)
+      m_adaptivePeriodicSync->onStateDiverged();
+  }
+
   // Try to record; the call will check if in suppression state
-  if (recordVector(*vvOther))
+  if (recordVector(*vvOther, isPartial))
     return;
 
   // If incoming state identical/newer to local vector, reset timer
@@ -197,14 +403,23 @@ SVSyncCore::onSyncInterestValidated(const Interest& interest)
   if (!result.myVectorNew) {
     retxSyncInterest(false, 0);
   } else {
-    enterSuppressionState(*vvOther);
+    enterSuppressionState(*vvOther, isPartial);
     // Check how much time is left on the timer,
     // reset to ~m_intrReplyDist if more than that.
-    int delay = m_intrReplyDist(m_rng);
+    int delay = 0;
 
     // Curve the delay for better suppression in large groups
-    // TODO: efficient curve depends on number of active nodes
-    delay = suppressionCurve(m_maxSuppressionTime.count(), delay);
+    if (m_adaptiveSuppression) {
+      // The window follows duplicate replies, the curve the active nodes
+      int window = m_adaptiveSuppression->getWindow().count();
+      delay = std::uniform_int_distribution<>(0, window)(m_rng);
+      delay = AdaptiveSuppression::curve(window, delay, m_adaptiveSuppression->getCurveFactor());
+      delay = std::max(delay, 1);
+    } else {
+      delay = m_intrReplyDist(m_rng);
+      delay = AdaptiveSuppression::curve(
+        m_maxSuppressionTime.count(), delay, AdaptiveSuppression::DEFAULT_CURVE_FACTOR);
+    }
 
     if (getCurrentTime() + delay * 1000 < m_nextSyncInterest) {
       retxSyncInterest(false, delay);
@@ -212,30 +427,92 @@ SVSyncCore::onSyncInterestValidated(const Interest& interest)
   }
 }
 
+Compressor*
+SVSyncCore::findDecompressor(uint32_t type)
+{
+  if (m_compressor && m_compressor->getType() == type)
+    return m_compressor.get();
+
+  std::lock_guard<std::mutex> lock(m_decompressorsMutex);
+  auto& decompressor = m_decompressors[type];
+  if (decompressor)
+    return decompressor.get();
+
+#ifdef NDN_SVS_COMPRESSION
+  if (type == tlv::LzmaBlock)
+    decompressor = std::make_unique<LzmaCompressor>();
+#endif
+#ifdef NDN_SVS_HAVE_ZSTD
+  if (type == tlv::ZstdBlock)
+    decompressor = std::make_unique<ZstdCompressor>();
+#endif
+  return decompressor.get();
+}
+
 void
-SVSyncCore::retxSyncInterest(bool send, unsigned int delay)
+SVSyncCore::retxSyncInterest(bool send, unsigned int delay, bool urgent)
 {
+  // Inactive members are checked at most once per periodic sync, and
+  // before sending, so that pruned entries are not advertised again
+  if (delay == 0)
+    pruneInactiveMembers();
+
+  if (send) {
+    // Defer the interest until a token is available; urgent interests
+    // are sent anyway
+    auto wait = urgent ? time::nanoseconds::zero() : m_syncInterestBucket.getWaitTime();
+
+    if (wait > time::nanoseconds::zero()) {
+      auto waitMs = std::chrono::ceil<time::milliseconds>(wait);
+      m_nextSyncInterest = getCurrentTime() + 1000 * waitMs.count();
+      m_pendingSyncInterest = m_nextSyncInterest;
+      m_retxEvent = m_scheduler.schedule(waitMs, [this] { retxSyncInterest(true, 0); });
+      return;
+    }
+
+    m_pendingSyncInterest = 0;
+  }
+
   if (send) {
     std::lock_guard<std::mutex> lock(m_recordedVvMutex);
 
     // Only send interest if in steady state or local vector has newer state
     // than recorded interests
-    if (!m_recordedVv || mergeStateVector(*m_recordedVv).myVectorNew)
+    bool isSuppressing = m_recordedVv != nullptr;
+    bool isSending = !isSuppressing || mergeStateVector(*m_recordedVv, m_recordedVvPartial).myVectorNew;
+    if (isSending) {
+      // Suppressed replies leave the token for the next interest; urgent
+      // interests are charged too, which may put the bucket into debt
+      m_syncInterestBucket.charge(1);
       sendSyncInterest();
+    }
     m_recordedVv = nullptr;
+
+    if (isSuppressing && m_adaptiveSuppression)
+      m_adaptiveSuppression->onSuppressionEnd(m_suppressionReplies + (isSending ? 1 : 0));
   }
 
-  if (delay == 0)
-    delay = m_retxDist(m_rng);
+  if (delay == 0) {
+    if (m_adaptivePeriodicSync) {
+      // The interval follows the consistency of the group
+      auto interval = m_adaptivePeriodicSync->nextInterval().count();
+      delay = std::uniform_int_distribution<>(interval * (1.0 - m_periodicSyncJitter),
+                                              interval * (1.0 + m_periodicSyncJitter))(m_rng);
+    } else {
+      delay = m_retxDist(m_rng);
+    }
+  }
 
-  {
-    std::lock_guard<std::mutex> lock(m_schedulerMutex);
+  // Resetting the timer must not postpone a coalesced or deferred send
+  auto now = getCurrentTime();
+  auto next = now + 1000 * delay;
+  if (m_pendingSyncInterest > 0 && m_pendingSyncInterest < next)
+    next = std::max(m_pendingSyncInterest, now);
 
-    // Store the scheduled time
-    m_nextSyncInterest = getCurrentTime() + 1000 * delay;
+  // Store the scheduled time
+  m_nextSyncInterest = next;
 
-    m_retxEvent = m_scheduler.schedule(time::milliseconds(delay), [this] { retxSyncInterest(true, 0); });
-  }
+  m_retxEvent = m_scheduler.schedule(time::microseconds(next - now), [this] { retxSyncInterest(true, 0); });
 }
 
 void
@@ -244,40 +521,113 @@ SVSyncCore::sendSyncInterest()
   if (!m_initialized)
     return;
 
-  // Build app parameters
-  ndn::encoding::EncodingBuffer enc;
-  {
-    std::lock_guard<std::mutex> lock(m_vvMutex);
-    size_t length = 0;
+  // Send the full vector periodically and when others are missing state
+  auto now = time::steady_clock::now();
+  bool sendFull = m_partialVectorSize == 0 || m_sendFullVector ||
+                  now - m_lastFullVector >= getPeriodicSyncTime() * (1.0 - m_periodicSyncJitter);
 
-    // Add extra mapping blocks
-    if (m_getExtraBlock)
-      length += ndn::encoding::prependBlock(enc, m_getExtraBlock(m_vv));
+  auto vv = getState();
+  bool isPartial = !sendFull && vv->size() > m_partialVectorSize;
+  sendFull = !isPartial;
+
+  // Add extra mapping blocks
+  Block extra;
+  if (m_getExtraBlock) {
+    extra = m_getExtraBlock(*vv);
+    extra.encode();
+  }
 
-    // Add state vector
-    length += ndn::encoding::prependBlock(enc, m_vv.encode());
+  // Add state vector; entries of the snapshot are already encoded
+  auto vvWire = isPartial ? vv->encodeRecent(m_partialVectorSize) : vv->encode();
 
-    // Add length and ApplicationParameters type
+  if (sendFull) {
+    m_sendFullVector = false;
+    m_lastFullVector = now;
+  }
+
+  // Split vectors that would exceed the size limit
+  size_t size = FRAGMENT_OVERHEAD + vvWire.size() + (extra.isValid() ? extra.size() : 0);
+  if (m_maxSyncParametersSize > 0 && size > m_maxSyncParametersSize && vv->size() > 1) {
+    auto fragments = encodeSyncFragments(vvWire, extra, isPartial);
+    // Each fragment is a sync interest; the caller paid for the first one
+    m_syncInterestBucket.charge(fragments.size() - 1);
+    for (auto& params : fragments)
+      sendSyncParameters(std::move(params));
+    return;
+  }
+
+  sendSyncParameters(encodeSyncParameters(vvWire, extra, isPartial));
+}
+
+std::vector<Block>
+SVSyncCore::encodeSyncFragments(const Block& vvWire, const Block& extra, bool isPartial)
+{
+  std::vector<Block> fragments;
+  vvWire.parse();
+  const auto& entries = vvWire.elements();
+
+  // Encoded NodeID of an entry, which bounds the fragment before it
+  auto nodeIdWire = [](const Block& entry) -> const Block& {
+    entry.parse();
+    return entry.elements().at(0);
+  };
+
+  // Space left for the entries; oversized entries are sent on their own
+  size_t overhead = FRAGMENT_OVERHEAD + (extra.isValid() ? extra.size() : 0);
+  size_t budget = m_maxSyncParametersSize > overhead ? m_maxSyncParametersSize - overhead : 0;
+  size_t index = 0;
+
+  auto addFragment = [&](auto first, auto last) {
+    ndn::encoding::EncodingBuffer enc;
+    size_t length = 0;
+    for (auto it = std::make_reverse_iterator(last); it != std::make_reverse_iterator(first); ++it)
+      length += ndn::encoding::prependBlock(enc, *it);
     enc.prependVarNumber(length);
-    enc.prependVarNumber(ndn::tlv::ApplicationParameters);
+    enc.prependVarNumber(tlv::StateVector);
+
+    // Fragments of a full vector describe all NodeIDs up to the next fragment
+    Block marker;
+    if (!isPartial) {
+      marker = Block(tlv::StateVectorFragment);
+      marker.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::FragmentIndex, index));
+      if (last != entries.end())
+        marker.push_back(nodeIdWire(*last));
+      marker.encode();
+    }
+
+    fragments.push_back(encodeSyncParameters(enc.block(), index == 0 ? extra : Block(), true, marker));
+    index++;
+  };
+
+  // Greedily fill each fragment, leaving room for the bound after it
+  auto first = entries.begin();
+  size_t length = 0;
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    auto next = std::next(it);
+    size_t bound = isPartial || next == entries.end() ? 0 : nodeIdWire(*next).size();
+    if (it != first && length + it->size() + bound > budget) {
+      addFragment(first, it);
+      first = it;
+      length = 0;
+    }
+    length += it->size();
   }
+  addFragment(first, entries.end());
 
-  ndn::Block wire = enc.block();
-  wire.encode();
+  return fragments;
+}
 
-#ifdef NDN_SVS_COMPRESSION
-  boost::iostreams::filtering_istreambuf in;
-  in.push(boost::iostreams::lzma_compressor());
-  in.push(boost::iostreams::array_source(reinterpret_cast<const char*>(wire.data()), wire.size()));
-  ndn::OBufferStream compressed;
-  boost::iostreams::copy(in, compressed);
-  wire = ndn::Block(tlv::LzmaBlock, compressed.buf());
-  wire.encode();
-#endif
+void
+SVSyncCore::sendSyncParameters(Block params)
+{
+  if (m_compressor) {
+    params = m_compressor->compress({ params.data(), params.size() });
+    params.encode();
+  }
 
   // Create Sync Interest
-  Interest interest(Name(m_syncPrefix).appendVersion(2));
-  interest.setApplicationParameters(wire);
+  Interest interest(m_compactEncoding ? m_compactSyncInterestName : m_syncInterestName);
+  interest.setApplicationParameters(params);
   interest.setInterestLifetime(1_ms);
 
   switch (m_securityOptions.interestSigner->signingInfo.getSignerType()) {
@@ -285,7 +635,7 @@ SVSyncCore::sendSyncInterest()
       break;
 
     case security::SigningInfo::SIGNER_TYPE_HMAC:
-      m_keyChainMem.sign(interest, m_securityOptions.interestSigner->signingInfo);
+      m_hmacContext->sign(interest);
       break;
 
     default:
@@ -296,62 +646,270 @@ SVSyncCore::sendSyncInterest()
   m_face.expressInterest(interest, nullptr, nullptr, nullptr);
 }
 
+Block
+SVSyncCore::encodeSyncParameters(const Block& vvWire,
+                                 const Block& extra,
+                                 bool isPartial,
+                                 const Block& fragment)
+{
+  static const Block PARTIAL_MARKER = ndn::encoding::makeEmptyBlock(tlv::PartialStateVector);
+
+  Block vector = m_compactEncoding ? encodeCompactStateVector(StateVectorView(vvWire)) : vvWire;
+
+  // Mark partial vectors; fragments are always partial
+  return m_bufferPool.encode(ndn::tlv::ApplicationParameters,
+                             {
+                               &vector,
+                               extra.isValid() ? &extra : nullptr,
+                               isPartial || fragment.isValid() ? &PARTIAL_MARKER : nullptr,
+                               fragment.isValid() ? &fragment : nullptr,
+                             });
+}
+
+/**
+ * @brief Three-way comparison of a local entry with an incoming entry
+ */
+static int
+compareEntry(const VersionVector::Entry& local, const VersionVector::Entry& other)
+{
+  return local.first.compare(other.first);
+}
+
+static int
+compareEntry(const VersionVector::Entry& local, const StateVectorView::Entry& other)
+{
+  return StateVectorView::compareNodeId(local.nodeIdWire.value_bytes(), other.nodeIdValue);
+}
+
+static SeqNo
+getEntrySeqNo(const VersionVector::Entry& entry)
+{
+  return entry.second;
+}
+
+static SeqNo
+getEntrySeqNo(const StateVectorView::Entry& entry)
+{
+  return entry.seqNo;
+}
+
+static NodeID
+getEntryNodeId(const VersionVector::Entry& entry)
+{
+  return entry.first;
+}
+
+static NodeID
+getEntryNodeId(const StateVectorView::Entry& entry)
+{
+  return entry.getNodeId();
+}
+
 SVSyncCore::MergeResult
-SVSyncCore::mergeStateVector(const VersionVector& vvOther)
+SVSyncCore::mergeStateVector(const VersionVector& vvOther,
+                             bool isPartial,
+                             const std::optional<FragmentRange>& fragment)
 {
   std::lock_guard<std::mutex> lock(m_vvMutex);
-  SVSyncCore::MergeResult result;
-
-  // Check if other vector has newer state
-  for (const auto& entry : vvOther) {
-    NodeID nidOther = entry.first;
-    SeqNo seqOther = entry.second;
-    SeqNo seqCurrent = m_vv.get(nidOther);
+  return mergeSortedStateVector(vvOther, isPartial, fragment);
+}
 
-    if (seqCurrent < seqOther) {
-      result.otherVectorNew = true;
+SVSyncCore::MergeResult
+SVSyncCore::mergeStateVector(const StateVectorView& vvOther,
+                             bool isPartial,
+                             const std::optional<FragmentRange>& fragment)
+{
+  // Entries of unsorted vectors cannot be merged in order
+  if (!vvOther.isSorted())
+    return mergeStateVector(VersionVector(vvOther), isPartial, fragment);
 
-      SeqNo startSeq = m_vv.get(nidOther) + 1;
-      result.missingInfo.push_back({ nidOther, startSeq, seqOther, 0 });
+  std::lock_guard<std::mutex> lock(m_vvMutex);
+  return mergeSortedStateVector(vvOther, isPartial, fragment);
+}
 
-      m_vv.set(nidOther, seqOther);
+template<typename Vector>
+SVSyncCore::MergeResult
+SVSyncCore::mergeSortedStateVector(const Vector& vvOther,
+                                   bool isPartial,
+                                   const std::optional<FragmentRange>& fragment)
+{
+  SVSyncCore::MergeResult result;
+  auto now = time::system_clock::now();
+
+  // Local entries updated within network RTT are not considered newer
+  auto isSettled = [&](const VersionVector::Entry& entry) {
+    return entry.lastUpdate <= now - m_maxSuppressionTime;
+  };
+
+  // Entries due for pruning are not considered newer either, since peers
+  // with the same timeout have pruned them already; replying with them
+  // would keep the group in a loop of immediate replies
+  auto isInactive = [&](const VersionVector::Entry& entry) {
+    return m_inactiveMemberTimeout > 0_ms && entry.lastUpdate < now - m_inactiveMemberTimeout &&
+           !isLocalNodeId(entry.first);
+  };
+
+  // Entries restored from expired tombstones without missing data
+  std::vector<std::pair<NodeID, SeqNo>> restored;
+
+  auto local = m_vv.begin();
+  auto other = vvOther.begin();
+
+  while (local != m_vv.end() || other != vvOther.end()) {
+    int cmp = local == m_vv.end() ? 1 : other == vvOther.end() ? -1 : compareEntry(*local, *other);
+
+    if (cmp < 0) {
+      // Absent entries of partial vectors are unknown, not older,
+      // unless the fragment describes the range of the entry
+      bool isCovered = !isPartial || (fragment && fragment->contains(local->first));
+      if (isCovered && local->second > 0 && isSettled(*local) && !isInactive(*local))
+        result.myVectorNew = true;
+      ++local;
+      continue;
     }
-  }
 
-  // Check if I have newer state
-  for (const auto& entry : m_vv) {
-    NodeID nid = entry.first;
-    SeqNo seq = entry.second;
-    SeqNo seqOther = vvOther.get(nid);
+    SeqNo seqOther = getEntrySeqNo(*other);
+    SeqNo seqCurrent = cmp == 0 ? local->second : 0;
 
-    // Ignore this node if it was last updated within network RTT
-    if (time::system_clock::now() - m_vv.getLastUpdate(nid) < m_maxSuppressionTime)
-      continue;
+    if (seqCurrent < seqOther) {
+      // Only decode the NodeID if it is actually needed
+      NodeID nidOther = cmp == 0 ? local->first : getEntryNodeId(*other);
+
+      // Pruned entries are only restored by newer sequence numbers within
+      // the lifetime of the tombstone. Later, stale vectors restore them
+      // too, at the pruned sequence number, without reporting the history.
+      if (cmp != 0 && !m_tombstones.empty()) {
+        auto tombstone = m_tombstones.find(nidOther);
+        if (tombstone != m_tombstones.end()) {
+          SeqNo seqPruned = tombstone->second.seqNo;
+          if (seqOther <= seqPruned && now < tombstone->second.expiry) {
+            ++other;
+            continue;
+          }
+          m_tombstones.erase(tombstone);
+          m_tombstonesChanged = true;
+
+          if (seqOther <= seqPruned) {
+            restored.emplace_back(nidOther, seqPruned);
+            ++other;
+            continue;
+          }
+          seqCurrent = seqPruned;
+        }
+      }
 
-    if (seqOther < seq) {
+      result.otherVectorNew = true;
+      result.missingInfo.push_back(
+        { nidOther, seqCurrent + 1, seqOther, 0, m_nodeIdRegistry->intern(nidOther) });
+    } else if (cmp == 0 && seqOther < seqCurrent && !(isPartial && seqOther == 0) && isSettled(*local)) {
       result.myVectorNew = true;
-      break;
     }
+
+    if (cmp == 0)
+      ++local;
+    ++other;
   }
 
+  // Update the local vector after the walk, which would be invalidated by inserts
+  for (const auto& info : result.missingInfo)
+    m_vv.set(info.nodeId, info.high);
+  for (const auto& [nid, seqNo] : restored)
+    m_vv.set(nid, seqNo);
+
+  if (!result.missingInfo.empty() || !restored.empty())
+    publishState();
+
   return result;
 }
 
 void
 SVSyncCore::reset(bool isOnInterest)
 {
+  // Drop suppression state and the vectors recorded in it
+  {
+    std::lock_guard<std::mutex> lock(m_recordedVvMutex);
+    m_recordedVv = nullptr;
+    m_recordedVvPartial = false;
+    m_suppressionReplies = 0;
+  }
+
+  // Restart with a full vector; a reset interest is answered like any
+  // other sync interest, so only the timer is restarted then
+  m_sendFullVector = true;
+  retxSyncInterest(!isOnInterest, 0);
+}
+
+void
+SVSyncCore::pruneInactiveMembers()
+{
+  if (m_inactiveMemberTimeout == 0_ms)
+    return;
+
+  auto now = time::system_clock::now();
+  std::vector<NodeID> inactive;
+  {
+    std::lock_guard<std::mutex> lock(m_vvMutex);
+    if (now < m_nextPrune)
+      return;
+    m_nextPrune = now + getPeriodicSyncTime();
+
+    for (const auto& entry : m_vv) {
+      if (entry.lastUpdate < now - m_inactiveMemberTimeout && !isLocalNodeId(entry.first))
+        inactive.push_back(entry.first);
+    }
+
+    // Tombstones of members gone for good are dropped another lifetime
+    // after they expire, so the map stays bounded by the recent departures
+    for (auto it = m_tombstones.begin(); it != m_tombstones.end();) {
+      if (now >= it->second.expiry + m_tombstoneLifetime) {
+        it = m_tombstones.erase(it);
+        m_tombstonesChanged = true;
+      } else {
+        ++it;
+      }
+    }
+
+    for (const auto& nid : inactive) {
+      m_tombstones[nid] = { m_vv.get(nid), now + m_tombstoneLifetime };
+      m_vv.erase(nid);
+      m_tombstonesChanged = true;
+    }
+
+    if (!m_tombstonesChanged)
+      return;
+
+    m_nPrunedEntries += inactive.size();
+    publishState();
+  }
+
+  // Release the handles of pruned members, unless they are still in use
+  for (const auto& nid : inactive) {
+    auto handle = m_nodeIdRegistry->find(nid);
+    if (!handle || (m_onPrune && !m_onPrune(nid, *handle)))
+      continue;
+
+    if (m_adaptiveSuppression)
+      m_adaptiveSuppression->forget(*handle);
+    m_nodeIdRegistry->release(*handle);
+  }
 }
 
 SeqNo
 SVSyncCore::getSeqNo(const NodeID& nid) const
 {
-  std::lock_guard<std::mutex> lock(m_vvMutex);
-  NodeID t_nid = (nid == EMPTY_NODE_ID) ? m_id : nid;
-  return m_vv.get(t_nid);
+  const NodeID& t_nid = (nid == EMPTY_NODE_ID) ? m_id : nid;
+  SeqNo seq = getState()->get(t_nid);
+  if (seq > 0 || m_inactiveMemberTimeout == 0_ms)
+    return seq;
+
+  // Pruned members continue from their last sequence number
+  auto tombstones = std::atomic_load(&m_tombstonesSnapshot);
+  auto tombstone = tombstones->find(t_nid);
+  return tombstone == tombstones->end() ? 0 : tombstone->second.seqNo;
 }
 
 void
-SVSyncCore::updateSeqNo(const SeqNo& seq, const NodeID& nid)
+SVSyncCore::updateSeqNo(const SeqNo& seq, const NodeID& nid, bool urgent)
 {
   NodeID t_nid = (nid == EMPTY_NODE_ID) ? m_id : nid;
 
@@ -359,49 +917,116 @@ SVSyncCore::updateSeqNo(const SeqNo& seq, const NodeID& nid)
   {
     std::lock_guard<std::mutex> lock(m_vvMutex);
     prev = m_vv.get(t_nid);
+    if (auto tombstone = m_tombstones.find(t_nid); tombstone != m_tombstones.end()) {
+      prev = tombstone->second.seqNo;
+      m_tombstones.erase(tombstone);
+      m_tombstonesChanged = true;
+    }
     m_vv.set(t_nid, seq);
+    if (t_nid != m_id)
+      m_localNodeIds.insert(t_nid);
+    publishState();
   }
 
-  if (seq > prev)
-    retxSyncInterest(false, 1);
+  if (seq <= prev)
+    return;
+
+  // Updates may come from any thread, while timers and sending belong to
+  // the thread of the face, whose scheduler may be shared by many groups
+  std::weak_ptr<void> alive = m_alive;
+  boost::asio::post(m_face.getIoContext(), [this, alive, t_nid, urgent] {
+    if (!alive.expired())
+      scheduleUpdate(t_nid, urgent);
+  });
+}
+
+void
+SVSyncCore::scheduleUpdate(const NodeID& nid, bool urgent)
+{
+  if (m_adaptiveSuppression)
+    m_adaptiveSuppression->onNodeActive(m_nodeIdRegistry->intern(nid));
+  if (m_adaptivePeriodicSync)
+    m_adaptivePeriodicSync->onStateChanged();
+
+  if (urgent) {
+    retxSyncInterest(true, 0, true);
+    return;
+  }
+
+  // The update is sent within the window, even if the timer is reset
+  // meanwhile by incoming sync interests
+  auto window = m_coalescingWindow;
+  auto deadline = getCurrentTime() + 1000 * window.count();
+  if (m_pendingSyncInterest == 0 || deadline < m_pendingSyncInterest)
+    m_pendingSyncInterest = deadline;
+
+  // If a sync interest is already due within the window, it will carry
+  // this update; rescheduling for every update would postpone it forever
+  if (m_nextSyncInterest > deadline)
+    retxSyncInterest(false, window.count());
 }
 
 std::set<NodeID>
 SVSyncCore::getNodeIds() const
 {
-  std::lock_guard<std::mutex> lock(m_vvMutex);
   std::set<NodeID> sessionNames;
-  for (const auto& nid : m_vv) {
+  for (const auto& nid : *getState()) {
     sessionNames.insert(nid.first);
   }
   return sessionNames;
 }
 
+void
+SVSyncCore::setState(const VersionVector& vv)
+{
+  auto now = time::system_clock::now();
+
+  std::lock_guard<std::mutex> lock(m_vvMutex);
+  m_vv = vv;
+  for (const auto& entry : vv)
+    m_vv.set(entry.first, entry.second, now);
+  publishState();
+}
+
+void
+SVSyncCore::publishState()
+{
+  // Fill the encoding caches, which are shared with the copy
+  m_vv.cacheEncoding();
+  std::atomic_store(&m_vvSnapshot, std::make_shared<const VersionVector>(m_vv));
+
+  // Tombstones change rarely, and are only copied when they do
+  if (m_tombstonesChanged) {
+    std::atomic_store(&m_tombstonesSnapshot, std::make_shared<const TombstoneMap>(m_tombstones));
+    m_tombstonesChanged = false;
+  }
+}
+
 long
 SVSyncCore::getCurrentTime() const
 {
-  return std::chrono::duration_cast<std::chrono::microseconds>(
-           std::chrono::steady_clock::now().time_since_epoch())
-    .count();
+  return time::duration_cast<time::microseconds>(time::steady_clock::now().time_since_epoch()).count();
 }
 
 bool
-SVSyncCore::recordVector(const VersionVector& vvOther)
+SVSyncCore::recordVector(const StateVectorView& vvOther, bool isPartial)
 {
   std::lock_guard<std::mutex> lock(m_recordedVvMutex);
 
   if (!m_recordedVv)
     return false;
 
-  std::lock_guard<std::mutex> lock1(m_vvMutex);
+  m_recordedVvPartial = m_recordedVvPartial && isPartial;
+
+  // Interests in suppression state are replies to the outdated vector
+  m_suppressionReplies++;
 
   for (const auto& entry : vvOther) {
-    NodeID nidOther = entry.first;
-    SeqNo seqOther = entry.second;
-    SeqNo seqCurrent = m_recordedVv->get(nidOther);
+    SeqNo seqOther = entry.seqNo;
+    SeqNo seqCurrent = m_recordedVv->get(entry);
 
     if (seqCurrent < seqOther) {
-      m_recordedVv->set(nidOther, seqOther);
+      m_recordedVv->set(entry.getNodeId(), seqOther);
     }
   }
 
@@ -409,12 +1034,15 @@ SVSyncCore::recordVector(const VersionVector& vvOther)
 }
 
 void
-SVSyncCore::enterSuppressionState(const VersionVector& vvOther)
+SVSyncCore::enterSuppressionState(const StateVectorView& vvOther, bool isPartial)
 {
   std::lock_guard<std::mutex> lock(m_recordedVvMutex);
 
-  if (!m_recordedVv)
+  if (!m_recordedVv) {
     m_recordedVv = std::make_unique<VersionVector>(vvOther);
+    m_recordedVvPartial = isPartial;
+    m_suppressionReplies = 0;
+  }
 }
 
 } // namespace ndn::svs
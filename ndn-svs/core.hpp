@@ -17,15 +17,27 @@
 #ifndef NDN_SVS_CORE_HPP
 #define NDN_SVS_CORE_HPP
 
+#include "adaptive-periodic-sync.hpp"
+#include "adaptive-suppression.hpp"
+#include "buffer-pool.hpp"
 #include "common.hpp"
+#include "compressor.hpp"
+#include "duplicate-filter.hpp"
+#include "hmac-context.hpp"
+#include "node-id-registry.hpp"
 #include "security-options.hpp"
+#include "token-bucket.hpp"
+#include "validation-pool.hpp"
 #include "version-vector.hpp"
 
 #include <ndn-cxx/util/random.hpp>
 #include <ndn-cxx/util/scheduler.hpp>
 
 #include <atomic>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <set>
 
 namespace ndn::svs {
 
@@ -40,6 +52,15 @@ public:
   SeqNo high;
   /// @brief ndn::lp::IncomingFaceIdTag
   uint64_t incomingFace;
+  /**
+   * @brief interned handle of nodeId, see SVSyncCore::getNodeIdRegistry
+   *
+   * With SyncCoreOptions::inactiveMemberTimeout, the handle of a pruned
+   * member is released after the prune callback allows it, and may then be
+   * assigned to another NodeID. Tables indexed by handle must drop it in
+   * the callback, see SVSyncCore::setPruneCallback.
+   */
+  NodeHandle nodeHandle = NodeIdRegistry::INVALID_HANDLE;
 };
 
 /**
@@ -50,6 +71,77 @@ public:
  */
 using UpdateCallback = std::function<void(const std::vector<MissingDataInfo>&)>;
 
+/**
+ * @brief Timer options for SVS core constructor
+ */
+struct SyncCoreOptions
+{
+  /**
+   * @brief Max suppression time.
+   *
+   * This value is roughly positively correlated to the network diameter.
+   */
+  time::milliseconds maxSuppressionTime = 500_ms;
+
+  /**
+   * @brief Periodic sync interval.
+   *
+   * Can be set lower for highly lossy networks.
+   */
+  time::milliseconds periodicSyncTime = 30_s;
+
+  /**
+   * @brief Fraction of jitter in the periodic sync interval, in [0, 1).
+   *
+   * Positively correlated to the network diameter.
+   */
+  double periodicSyncJitter = 0.1;
+
+  /**
+   * @brief Adapt the periodic sync interval to the group.
+   *
+   * The interval is shortened down to minPeriodicSyncTime when peers are
+   * found to be missing state, and stretched up to maxPeriodicSyncTime
+   * when the group is quiescent.
+   */
+  bool adaptivePeriodicSync = false;
+
+  /// @brief Lower bound of the adaptive periodic sync interval
+  time::milliseconds minPeriodicSyncTime = 5_s;
+
+  /// @brief Upper bound of the adaptive periodic sync interval
+  time::milliseconds maxPeriodicSyncTime = 120_s;
+
+  /**
+   * @brief Prune entries of members not updated for this long (0 to keep all).
+   *
+   * Pruned entries are no longer sent in sync interests. Should be the same
+   * in all members, otherwise peers keep replying with the pruned entries.
+   * The own NodeID and the NodeIDs published with SVSyncCore::updateSeqNo
+   * are never pruned.
+   * The NodeIdRegistry handles of pruned members are released, and are
+   * reused for members seen later, once the prune callback allows it; see
+   * SVSyncCore::setPruneCallback and MissingDataInfo::nodeHandle.
+   */
+  time::milliseconds inactiveMemberTimeout = 0_ms;
+
+  /**
+   * @brief Lifetime of the tombstones of pruned entries.
+   *
+   * Stale vectors of peers do not restore pruned entries within the
+   * lifetime; a newer sequence number of the member always does. After
+   * the lifetime, stale vectors restore the entry without reporting the
+   * history up to the pruned sequence number again. The NodeID and last
+   * sequence number of a pruned member are kept until it is restored, or
+   * until another lifetime has passed after the expiry. A member seen after
+   * that is treated as new, and its history is fetched again from the start.
+   * Must not be shorter than the inactiveMemberTimeout.
+   */
+  time::milliseconds tombstoneLifetime = time::hours(24);
+};
+
+class SyncGroupManager;
+
 /**
  * @brief Pure SVS
  */
@@ -71,18 +163,48 @@ public:
    * @param onUpdate The callback function to handle state updates
    * @param syncKey Base64 encoded key to sign sync interests
    * @param nid ID for the node
+   * @param options Timer options
+   * @throws Error if the options are invalid
+   * @throws HmacContext::Error if HMAC signing is configured without a key
    */
   SVSyncCore(ndn::Face& face,
              const Name& syncPrefix,
              const UpdateCallback& onUpdate,
              const SecurityOptions& securityOptions = SecurityOptions::DEFAULT,
-             const NodeID& nid = EMPTY_NODE_ID);
+             const NodeID& nid = EMPTY_NODE_ID,
+             const SyncCoreOptions& options = {});
+
+private:
+  /**
+   * @brief Constructor of a core hosted by a SyncGroupManager
+   *
+   * A hosted core schedules its timers on @p scheduler and does not register
+   * its sync prefix; the manager dispatches sync interests to it.
+   *
+   * @param scheduler shared scheduler, or nullptr to use an own one and
+   *        register the sync prefix
+   */
+  SVSyncCore(ndn::Face& face,
+             ndn::Scheduler* scheduler,
+             const Name& syncPrefix,
+             const UpdateCallback& onUpdate,
+             const SecurityOptions& securityOptions,
+             const NodeID& nid,
+             const SyncCoreOptions& options);
+
+  friend class SyncGroupManager;
+
+public:
 
   /**
    * @brief Reset the sync tree (and restart synchronization again)
    *
+   * Leaves suppression state and sends the full vector with the next sync
+   * interest. The version vector and tombstones are kept.
+   *
    * @param isOnInterest a flag that tells whether the reset is called by reset
-   * interest.
+   * interest. If not, a sync interest is sent right away; otherwise only the
+   * periodic timer is restarted.
    */
   void reset(bool isOnInterest = false);
 
@@ -111,22 +233,56 @@ public:
    *
    * The method updates the existing seqNo with the supplied seqNo and NodeID.
    *
+   * Sync interests for updates are coalesced: the update is sent with the
+   * next sync interest, which is sent at most the coalescing window later.
+   * The sync interest is scheduled by the thread of the face, so this may
+   * be called from any thread.
+   *
    * @param seq The new seqNo.
    * @param nid The NodeID of node to update.
+   * @param urgent Send a sync interest as soon as the thread of the face
+   *        runs, bypassing the coalescing window and the rate limit.
    */
-  void updateSeqNo(const SeqNo& seq, const NodeID& nid = EMPTY_NODE_ID);
+  void updateSeqNo(const SeqNo& seq, const NodeID& nid = EMPTY_NODE_ID, bool urgent = false);
+
+private:
+  /// @brief Schedule the sync interest of a local update, on the thread of the face
+  void scheduleUpdate(const NodeID& nid, bool urgent);
+
+public:
 
   /// @brief Get all the nodeIDs
   std::set<NodeID> getNodeIds() const;
 
+  /**
+   * @brief Callback for a member pruned as inactive
+   * @returns whether the handle of the member can be released
+   */
+  using PruneCallback = std::function<bool(const NodeID&, NodeHandle)>;
+
+  /**
+   * @brief Set the callback for members pruned as inactive
+   *
+   * Handles of pruned members are released from the NodeID registry, so
+   * that the registry does not grow with every member ever seen. Tables
+   * indexed by handle should drop the handle in the callback, or return
+   * false to keep it while still in use. Without a callback, all handles
+   * of pruned members are released.
+   */
+  void setPruneCallback(const PruneCallback& callback)
+  {
+    m_onPrune = callback;
+  }
+
   using GetExtraBlockCallback = std::function<ndn::Block(const VersionVector&)>;
   using RecvExtraBlockCallback = std::function<void(const ndn::Block&, const VersionVector&)>;
+  using RecvExtraBlockViewCallback = std::function<void(const ndn::Block&, const StateVectorView&)>;
 
   /**
    * @brief Callback to get extra data block for sync interest.
    *
-   * The version vector will be locked during the duration of this callback,
-   * so it must return FAST!
+   * The callback receives the snapshot of the version vector being sent.
+   * It is called for every sync interest, so it must return FAST!
    */
   void setGetExtraBlockCallback(const GetExtraBlockCallback& callback)
   {
@@ -136,28 +292,294 @@ public:
   /**
    * @brief Callback on receiving extra data in a sync interest.
    * Will be called BEFORE the interest is processed.
+   *
+   * The incoming state vector is decoded into a VersionVector for every
+   * sync interest; prefer setRecvExtraBlockViewCallback() where a view
+   * is enough. Replaces a callback set by either function.
    */
   void setRecvExtraBlockCallback(const RecvExtraBlockCallback& callback)
+  {
+    if (!callback) {
+      m_recvExtraBlock = nullptr;
+      return;
+    }
+    m_recvExtraBlock = [callback](const ndn::Block& block, const StateVectorView& view) {
+      callback(block, VersionVector(view));
+    };
+  }
+
+  /**
+   * @brief Callback on receiving extra data in a sync interest, with a
+   * view of the incoming state vector that is not decoded up front.
+   * Will be called BEFORE the interest is processed.
+   *
+   * Replaces a callback set by either function.
+   */
+  void setRecvExtraBlockViewCallback(const RecvExtraBlockViewCallback& callback)
   {
     m_recvExtraBlock = callback;
   }
 
-  /// @brief Get current version vector
-  VersionVector& getState()
+  /**
+   * @brief Send only recently updated entries in regular sync interests
+   *
+   * When enabled, sync interests triggered by updates carry only the
+   * @p maxEntries most recently updated entries, marked as partial.
+   * The full vector is still sent at the periodic sync interval and in
+   * replies to vectors that are missing local state.
+   *
+   * @param maxEntries maximum number of entries in a partial vector,
+   *        or 0 to always send the full vector (default)
+   */
+  void setPartialVectorSize(size_t maxEntries)
+  {
+    m_partialVectorSize = maxEntries;
+  }
+
+  /**
+   * @brief Send state vectors in the compact encoding
+   *
+   * Compact sync interests carry a CompactStateVector instead of the
+   * StateVector and are marked with a distinct version component, so
+   * either encoding is accepted on receipt. Enable only when all group
+   * members understand the compact encoding.
+   */
+  void setCompactEncoding(bool enable)
   {
-    return m_vv;
+    m_compactEncoding = enable;
+  }
+
+  /**
+   * @brief Split state vectors that do not fit in a single sync interest
+   *
+   * Vectors larger than @p maxSize are sent in several sync interests,
+   * each carrying consecutive entries as a partial vector. Fragments of a
+   * full vector are marked with the range of NodeIDs they describe, so
+   * the receiver still detects local entries missing at the sender.
+   * Fragments are accepted on receipt regardless of this setting; enable
+   * only when all group members understand fragments.
+   *
+   * @param maxSize maximum size of the ApplicationParameters before
+   *        compression, or 0 to never split (default)
+   */
+  void setMaxSyncParametersSize(size_t maxSize)
+  {
+    m_maxSyncParametersSize = maxSize;
+  }
+
+  /**
+   * @brief Set the coalescing window of sync interests for local updates
+   *
+   * All updates within the window after the first one are carried by a
+   * single sync interest with the newest vector. Default is 1 ms.
+   */
+  void setCoalescingWindow(time::milliseconds window)
+  {
+    m_coalescingWindow = std::max(window, time::milliseconds(1));
+  }
+
+  /**
+   * @brief Limit the rate of outgoing sync interests with a token bucket
+   *
+   * Sync interests exceeding the rate are deferred until a token is
+   * available. Urgent updates are never deferred, but are still charged
+   * and may put the bucket into debt. A vector split into fragments
+   * costs one token per fragment.
+   *
+   * @param rate sync interests per second, or 0 for no limit (default)
+   * @param burst maximum number of sync interests sent back to back
+   */
+  void setSyncInterestRateLimit(double rate, size_t burst = 1)
+  {
+    m_syncInterestBucket.setRate(rate, burst);
+  }
+
+  /**
+   * @brief Adapt the suppression timer to duplicate replies and active nodes
+   *
+   * When enabled, the curve of the suppression timer follows the number of
+   * nodes that published within the periodic sync interval, and the
+   * suppression window follows the number of duplicate replies observed
+   * in suppression state. The window starts at the maximum suppression
+   * time and may grow up to four times that in large groups.
+   */
+  void setAdaptiveSuppression(bool enable)
+  {
+    m_adaptiveSuppression = enable ? std::make_unique<AdaptiveSuppression>(
+                                       m_maxSuppressionTime, 4 * m_maxSuppressionTime, m_periodicSyncTime)
+                                   : nullptr;
+  }
+
+  /**
+   * @brief Verify signatures of sync interests on a thread pool
+   *
+   * Verified interests are merged on the thread of the face. When the pool
+   * falls behind, the oldest waiting interests are dropped. HMAC signatures
+   * are verified on the pool. Validators are not thread-safe: they look up
+   * the key of the signer on the thread of the face with
+   * BaseValidator::getVerificationKey, and only the public-key signature
+   * check, e.g. ECDSA, runs on the pool. Interests for which the validator
+   * returns no key are validated entirely on the thread of the face.
+   *
+   * @param nThreads number of threads, or 0 to verify on the thread of the face (default)
+   * @param maxQueueSize maximum number of interests waiting for verification
+   */
+  void setValidationThreads(size_t nThreads, size_t maxQueueSize = 256)
+  {
+    m_validationPool = nThreads > 0 ? std::make_shared<ValidationPool>(nThreads, maxQueueSize) : nullptr;
+  }
+
+  /**
+   * @brief Reject exact copies of recent sync interests
+   *
+   * Copies of a sync interest, such as those received over several faces,
+   * are rejected before they are verified or decoded. Unsigned interests
+   * are identified by their parameters alone, so identical vectors sent
+   * by different peers are rejected as copies as well. Disabled by default.
+   *
+   * @param lifetime time for which an interest is remembered, or 0 to disable the filter
+   * @param maxEntries maximum number of remembered interests
+   */
+  void setDuplicateFilter(time::milliseconds lifetime, size_t maxEntries = 1024)
+  {
+    m_duplicateFilter = lifetime > time::milliseconds::zero()
+                          ? std::make_unique<DuplicateFilter>(lifetime, maxEntries)
+                          : nullptr;
+  }
+
+  /**
+   * @brief Compress the parameters of sync interests
+   *
+   * Incoming interests are decompressed with the same compressor, so all
+   * members of the group must use the same codec, and the same dictionary
+   * if any. Interests compressed with the other codec are still accepted
+   * if it is compiled in, zstd only without a dictionary; otherwise they
+   * are counted in Counters::nDecompressionDrops. Builds with the
+   * compression extension default to LzmaCompressor.
+   *
+   * @param compressor compressor to use, or nullptr to disable compression
+   */
+  void setCompressor(std::shared_ptr<Compressor> compressor)
+  {
+    m_compressor = std::move(compressor);
+  }
+
+  /**
+   * @brief Get a snapshot of the current version vector
+   *
+   * A new immutable snapshot is published on every update, so readers never
+   * wait for concurrent merges or updates, and a snapshot stays consistent
+   * for as long as it is held.
+   */
+  std::shared_ptr<const VersionVector> getState() const
+  {
+    return std::atomic_load(&m_vvSnapshot);
+  }
+
+  /**
+   * @brief Get the NodeID interning table of this instance
+   *
+   * Handles in MissingDataInfo are assigned from this table.
+   */
+  const std::shared_ptr<NodeIdRegistry>& getNodeIdRegistry() const
+  {
+    return m_nodeIdRegistry;
+  }
+
+  /// @brief Counters of incoming sync interests
+  struct Counters
+  {
+    /// @brief Sync interests validated and processed
+    uint64_t nSyncInterests = 0;
+    /// @brief Sync interests whose vector matched the local digest and were not merged
+    uint64_t nDigestHits = 0;
+    /// @brief Sync interests dropped because the validation pool was behind
+    uint64_t nValidationDrops = 0;
+    /// @brief Sync interests dropped because their validation threw
+    uint64_t nValidationFailures = 0;
+    /// @brief Sync interests dropped because their parameters could not be decompressed
+    uint64_t nDecompressionDrops = 0;
+    /// @brief Sync interests rejected as copies of recent interests
+    uint64_t nDuplicateHits = 0;
+    /// @brief Sync interests checked against recent interests and not found
+    uint64_t nDuplicateMisses = 0;
+    /// @brief Entries pruned from the local vector as inactive
+    uint64_t nPrunedEntries = 0;
+  };
+
+  /// @brief Get the counters of incoming sync interests
+  Counters getCounters() const
+  {
+    auto pool = m_validationPool;
+    return {
+      m_nSyncInterests,      m_nDigestHits,    pool ? pool->getDropped() : 0, pool ? pool->getFailed() : 0,
+      m_nDecompressionDrops, m_nDuplicateHits, m_nDuplicateMisses,             m_nPrunedEntries,
+    };
+  }
+
+  /// @brief Get the current periodic sync interval
+  time::milliseconds getPeriodicSyncTime() const
+  {
+    return m_adaptivePeriodicSync ? m_adaptivePeriodicSync->getInterval() : m_periodicSyncTime;
   }
 
   /// @brief Get human-readable representation of version vector
   std::string getStateStr() const
   {
-    return m_vv.toStr();
+    return getState()->toStr();
   }
 
+  /// @brief Range of NodeIDs completely described by a fragment of a state vector
+  struct FragmentRange
+  {
+    /// @brief First NodeID in the range, unbounded if not set
+    std::optional<NodeID> begin;
+    /// @brief First NodeID after the range, unbounded if not set
+    std::optional<NodeID> end;
+
+    bool contains(const NodeID& nid) const
+    {
+      return (!begin || !(nid < *begin)) && (!end || nid < *end);
+    }
+  };
+
   NDN_SVS_PUBLIC_WITH_TESTS_ELSE_PRIVATE : void onSyncInterest(const Interest& interest);
 
+  /**
+   * @brief Replace the local version vector
+   *
+   * The entries count as updated now, so that restored members are only
+   * pruned after the inactive member timeout.
+   */
+  void setState(const VersionVector& vv);
+
+  /**
+   * @brief Publish a snapshot of the local version vector
+   *
+   * Outdated entries are encoded before publishing, so that readers only
+   * concatenate cached encodings. The snapshot shares all chunks with the
+   * local vector, so this costs no more than the updated chunks. Changed
+   * tombstones are published along with it. Must be called with m_vvMutex
+   * held.
+   */
+  void publishState();
+
   void onSyncInterestValidated(const Interest& interest);
 
+  /**
+   * @brief Find the compressor that decompresses blocks of type @p type
+   * @returns m_compressor if it produces that type, otherwise a default
+   *          compressor of that codec if compiled in, or nullptr
+   */
+  Compressor* findDecompressor(uint32_t type);
+
+  /**
+   * @brief Verify the signature of a sync interest
+   * @param onValidated called on success, possibly from another thread
+   */
+  void validateSyncInterest(const Interest& interest,
+                            const std::function<void(const Interest&)>& onValidated);
+
   /**
    * @brief Mark the instance as initialized and send the first interest
    */
@@ -166,11 +588,12 @@ public:
   /**
    * @brief sendSyncInterest and schedule a new retxSyncInterest event.
    *
-   * @param send Send a sync interest immediately
+   * @param send Send a sync interest immediately, subject to the rate limit
    * @param delay Delay in milliseconds to schedule next interest (0 for
    * default).
+   * @param urgent Send even if the rate limit is exceeded; the interest is still charged
    */
-  void retxSyncInterest(bool send, unsigned int delay);
+  void retxSyncInterest(bool send, unsigned int delay, bool urgent = false);
 
   /**
    * @brief Add one sync interest to queue.
@@ -180,12 +603,46 @@ public:
    */
   void sendSyncInterest();
 
+  /**
+   * @brief Split a state vector into the parameters of several sync interests
+   *
+   * Each fragment carries consecutive entries and fits the size limit,
+   * unless a single entry does not.
+   *
+   * @param vvWire encoded state vector to split
+   * @param extra extra block, sent with the first fragment only
+   * @param isPartial if @p vvWire is a partial vector
+   */
+  std::vector<Block> encodeSyncFragments(const Block& vvWire, const Block& extra, bool isPartial);
+
+  /**
+   * @brief Sign and express a sync interest
+   * @param params encoded ApplicationParameters
+   */
+  void sendSyncParameters(Block params);
+
+  /**
+   * @brief Encode the ApplicationParameters of a sync interest
+   *
+   * The parameters are encoded in a pooled buffer, which is reused once the
+   * interest is released. Must be called with m_recordedVvMutex held.
+   *
+   * @param vvWire encoded state vector to send
+   * @param extra extra block to send, if valid
+   * @param isPartial mark the vector as partial
+   * @param fragment fragment marker to send, if valid; implies isPartial
+   */
+  Block encodeSyncParameters(const Block& vvWire,
+                             const Block& extra,
+                             bool isPartial,
+                             const Block& fragment = {});
+
   struct MergeResult
   {
     /// @brief If the local state vector has newer entries
-    bool myVectorNew;
+    bool myVectorNew = false;
     /// @brief If the incoming state vector has newer entries
-    bool otherVectorNew;
+    bool otherVectorNew = false;
     /// @brief Newly learned missing information from incoming state vector
     std::vector<MissingDataInfo> missingInfo;
   };
@@ -193,16 +650,47 @@ public:
   /**
    * @brief Merge state vector into the current
    * @param vvOther state vector to merge in
+   * @param isPartial if vvOther is partial, absent entries are not
+   *        considered older than the local state
+   * @param fragment range of a partial vector in which absent entries
+   *        are older than the local state
    * @details Also adds missing data interests to data interest queue.
    */
-  MergeResult mergeStateVector(const VersionVector& vvOther);
+  MergeResult mergeStateVector(const VersionVector& vvOther,
+                               bool isPartial = false,
+                               const std::optional<FragmentRange>& fragment = std::nullopt);
+
+  /**
+   * @brief Merge an encoded state vector into the current
+   * @param vvOther view of the incoming state vector
+   * @param isPartial if vvOther is partial, absent entries are not
+   *        considered older than the local state
+   * @param fragment range of a partial vector in which absent entries
+   *        are older than the local state
+   * @details Only NodeIDs of entries newer than the local state are decoded.
+   */
+  MergeResult mergeStateVector(const StateVectorView& vvOther,
+                               bool isPartial = false,
+                               const std::optional<FragmentRange>& fragment = std::nullopt);
+
+  /**
+   * @brief Merge a state vector sorted by NodeID into the current
+   *
+   * Both vectors are walked once in NodeID order; the local vector must
+   * be locked by the caller.
+   */
+  template<typename Vector>
+  MergeResult mergeSortedStateVector(const Vector& vvOther,
+                                     bool isPartial,
+                                     const std::optional<FragmentRange>& fragment);
 
   /**
    * @brief Record vector by merging it into m_recordedVv
    * @param vvOther state vector to merge in
+   * @param isPartial if vvOther is a partial vector
    * @returns if recorded successfully
    */
-  bool recordVector(const VersionVector& vvOther);
+  bool recordVector(const StateVectorView& vvOther, bool isPartial = false);
 
   /**
    * @brief Enter suppression state by setting
@@ -210,8 +698,27 @@ public:
    * Does nothing if already in suppression state
    *
    * @param vvOther first vector to record
+   * @param isPartial if vvOther is a partial vector
+   */
+  void enterSuppressionState(const StateVectorView& vvOther, bool isPartial = false);
+
+  /**
+   * @brief Remove entries of members that were not updated recently
+   *
+   * The sequence numbers of removed entries are kept as tombstones, so that
+   * stale vectors do not restore them. Expired tombstones only keep the
+   * sequence number from which a restored entry continues, and are removed
+   * another tombstone lifetime after they expire.
+   * Handles of pruned members are released after the prune callback.
+   * Does nothing if called again within the periodic sync interval.
    */
-  void enterSuppressionState(const VersionVector& vvOther);
+  void pruneInactiveMembers();
+
+  /// @brief Whether @p nid is published by this node; requires m_vvMutex
+  bool isLocalNodeId(const NodeID& nid) const
+  {
+    return nid == m_id || m_localNodeIds.count(nid) > 0;
+  }
 
   /// @brief Reference to scheduler
   ndn::Scheduler& getScheduler()
@@ -235,26 +742,104 @@ private:
 
   const UpdateCallback m_onUpdate;
 
-  // State
+  // Names of sync interests, per state vector encoding
+  const Name m_syncInterestName;
+  const Name m_compactSyncInterestName;
+  // Buffers of outgoing sync interest parameters
+  BufferPool m_bufferPool;
+
+  // Interned NodeIDs, shared with pub/sub and mapping provider
+  const std::shared_ptr<NodeIdRegistry> m_nodeIdRegistry;
+
+  // State; m_vv is only accessed by writers, which hold m_vvMutex,
+  // while readers use the latest snapshot
   VersionVector m_vv;
   mutable std::mutex m_vvMutex;
+  std::shared_ptr<const VersionVector> m_vvSnapshot;
   // Aggregates incoming vectors while in suppression state
   std::unique_ptr<VersionVector> m_recordedVv = nullptr;
+  // If all recorded vectors were partial
+  bool m_recordedVvPartial = false;
+  // Sync interests received in the current suppression state
+  size_t m_suppressionReplies = 0;
   mutable std::mutex m_recordedVvMutex;
 
+  // Version component of sync interests, per state vector encoding
+  static constexpr uint64_t SYNC_VERSION = 2;
+  static constexpr uint64_t SYNC_VERSION_COMPACT = 0x102;
+
+  // Full vectors skipped by digest in a row before one is merged anyway
+  static constexpr size_t MAX_DIGEST_HITS_WITHOUT_MERGE = 16;
+  size_t m_nDigestHitsSinceMerge = 0;
+
+  // Partial state vectors; 0 to always send full vectors
+  size_t m_partialVectorSize = 0;
+  // Send the full vector with the next sync interest
+  std::atomic_bool m_sendFullVector = true;
+  // Time at which the last full vector was sent
+  time::steady_clock::time_point m_lastFullVector;
+
+  // Send CompactStateVector instead of StateVector
+  bool m_compactEncoding = false;
+  // Maximum size of sync interest parameters, 0 to never split
+  size_t m_maxSyncParametersSize = 0;
+  // Compression of sync interest parameters, if any
+  std::shared_ptr<Compressor> m_compressor;
+  // Decompressors of the other codecs, by TLV type, created on first use
+  std::map<uint32_t, std::unique_ptr<Compressor>> m_decompressors;
+  std::mutex m_decompressorsMutex;
+
+  // Counters of incoming sync interests
+  std::atomic<uint64_t> m_nSyncInterests = 0;
+  std::atomic<uint64_t> m_nDigestHits = 0;
+  std::atomic<uint64_t> m_nDecompressionDrops = 0;
+  std::atomic<uint64_t> m_nDuplicateHits = 0;
+  std::atomic<uint64_t> m_nDuplicateMisses = 0;
+
+  // Recently received sync interests, if filtering duplicates
+  std::unique_ptr<DuplicateFilter> m_duplicateFilter;
+
+  // Decides if handles of pruned members are released
+  PruneCallback m_onPrune;
+
   // Extra block
   GetExtraBlockCallback m_getExtraBlock;
-  RecvExtraBlockCallback m_recvExtraBlock;
-
-  // Max suppression time; this value is roughly
-  // positively correlated to the network diameter
-  time::milliseconds m_maxSuppressionTime;
-  // Periodic timer value; can be set to lower
-  // for highly lossy networks.
-  time::milliseconds m_periodicSyncTime;
-  // Fraction of jitter in the periodic timer value.
-  // Positively correlated to network diameter.
-  double m_periodicSyncJitter;
+  RecvExtraBlockViewCallback m_recvExtraBlock;
+
+  // Timer values, see SyncCoreOptions
+  const time::milliseconds m_maxSuppressionTime;
+  const time::milliseconds m_periodicSyncTime;
+  const double m_periodicSyncJitter;
+
+  // Adaptive periodic sync interval, if enabled
+  std::unique_ptr<AdaptivePeriodicSync> m_adaptivePeriodicSync;
+
+  // Pruning of inactive members, see SyncCoreOptions
+  const time::milliseconds m_inactiveMemberTimeout;
+  const time::milliseconds m_tombstoneLifetime;
+  // Time of the next check for inactive members, guarded by m_vvMutex;
+  // the first check is after one timeout
+  time::system_clock::time_point m_nextPrune;
+  // NodeIDs other than m_id published by this node, which are never
+  // pruned, guarded by m_vvMutex
+  std::set<NodeID> m_localNodeIds;
+
+  struct Tombstone
+  {
+    SeqNo seqNo;
+    time::system_clock::time_point expiry;
+  };
+  using TombstoneMap = std::map<NodeID, Tombstone>;
+  // Sequence numbers of pruned entries, kept until they are restored,
+  // guarded by m_vvMutex
+  TombstoneMap m_tombstones;
+  bool m_tombstonesChanged = true;
+  // Published with the state, so that getSeqNo never blocks
+  std::shared_ptr<const TombstoneMap> m_tombstonesSnapshot;
+  std::atomic<uint64_t> m_nPrunedEntries = 0;
+
+  // Adaptive suppression timer, if enabled
+  std::unique_ptr<AdaptiveSuppression> m_adaptiveSuppression;
 
   // Random Engine
   ndn::random::RandomNumberEngine& m_rng;
@@ -264,18 +849,36 @@ private:
   std::uniform_int_distribution<> m_intrReplyDist;
 
   // Security
-  ndn::KeyChain m_keyChainMem;
+  // Prepared key for HMAC signing, if used
+  std::unique_ptr<HmacContext> m_hmacContext;
 
-  ndn::Scheduler m_scheduler;
-  mutable std::mutex m_schedulerMutex;
+  // Own scheduler, unless hosted by a SyncGroupManager
+  std::unique_ptr<ndn::Scheduler> m_ownScheduler;
+  // Only used on the thread of the face, as it may be shared with other groups
+  ndn::Scheduler& m_scheduler;
   scheduler::ScopedEventId m_retxEvent;
   scheduler::ScopedEventId m_packetEvent;
 
   // Time at which the next sync interest will be sent
-  std::atomic_long m_nextSyncInterest;
+  std::atomic_long m_nextSyncInterest = 0;
+  // Deadline of a coalesced or deferred send, 0 if none; the periodic
+  // timer is never reset past it
+  long m_pendingSyncInterest = 0;
+
+  // Updates within this window share one sync interest
+  time::milliseconds m_coalescingWindow = 1_ms;
+  // Rate limit of outgoing sync interests
+  TokenBucket m_syncInterestBucket;
 
   // Prevent sending interests before initialization
   bool m_initialized = false;
+
+  // Expires with the core, so that work posted to the face is dropped
+  std::shared_ptr<void> m_alive = std::make_shared<int>(0);
+
+  // Verifies sync interests off the thread of the face, if set;
+  // declared last to join its threads before other members are destroyed
+  std::shared_ptr<ValidationPool> m_validationPool;
 };
 
 } // namespace ndn::svs
@@ -0,0 +1,63 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "duplicate-filter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ndn::svs {
+
+DuplicateFilter::DuplicateFilter(time::milliseconds lifetime, size_t maxEntries)
+  : m_lifetime(lifetime)
+  , m_maxEntries(std::max<size_t>(maxEntries, 1))
+{
+}
+
+bool
+DuplicateFilter::isDuplicate(const Name::Component& digest, time::steady_clock::time_point now)
+{
+  if (!digest.isParametersSha256Digest() || digest.value_size() < sizeof(uint64_t))
+    return false;
+
+  expire(now);
+
+  uint64_t key;
+  std::memcpy(&key, digest.value(), sizeof(key));
+
+  if (!m_keys.insert(key).second)
+    return true;
+
+  m_order.emplace_back(now, key);
+  if (m_order.size() > m_maxEntries) {
+    m_keys.erase(m_order.front().second);
+    m_order.pop_front();
+  }
+
+  return false;
+}
+
+void
+DuplicateFilter::expire(time::steady_clock::time_point now)
+{
+  while (!m_order.empty() && now - m_order.front().first >= m_lifetime) {
+    m_keys.erase(m_order.front().second);
+    m_order.pop_front();
+  }
+}
+
+} // namespace ndn::svs
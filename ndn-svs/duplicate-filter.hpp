@@ -0,0 +1,78 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_DUPLICATE_FILTER_HPP
+#define NDN_SVS_DUPLICATE_FILTER_HPP
+
+#include "common.hpp"
+
+#include <deque>
+#include <unordered_set>
+
+namespace ndn::svs {
+
+/**
+ * @brief Time-bounded set of recently seen sync interests
+ *
+ * Interests are identified by their ParametersSha256Digest component, which
+ * covers the application parameters and the signature of v0.3 signed
+ * interests. Exact copies, such as those delivered over several faces, can
+ * be rejected before they are verified or decoded. Entries are kept for the
+ * lifetime of the filter, and the oldest entries are evicted when the filter
+ * is full.
+ */
+class DuplicateFilter : noncopyable
+{
+public:
+  /**
+   * @param lifetime time for which an interest is remembered
+   * @param maxEntries maximum number of remembered interests
+   */
+  explicit DuplicateFilter(time::milliseconds lifetime = 1_s, size_t maxEntries = 1024);
+
+  /**
+   * @brief Check if an interest was seen within the lifetime, and remember it
+   *
+   * @param digest ParametersSha256Digest component of the interest name
+   * @returns true if the interest is a duplicate; false if it was not seen,
+   *          or if @p digest is not a ParametersSha256Digest component
+   */
+  bool isDuplicate(const Name::Component& digest,
+                   time::steady_clock::time_point now = time::steady_clock::now());
+
+  /// @brief Number of remembered interests
+  size_t size() const
+  {
+    return m_keys.size();
+  }
+
+private:
+  void expire(time::steady_clock::time_point now);
+
+private:
+  const time::milliseconds m_lifetime;
+  const size_t m_maxEntries;
+
+  // The digest is a SHA-256 hash, so its first 8 bytes are used as the key
+  std::unordered_set<uint64_t> m_keys;
+  // Keys in order of insertion, with their insertion time
+  std::deque<std::pair<time::steady_clock::time_point, uint64_t>> m_order;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_DUPLICATE_FILTER_HPP
@@ -17,13 +17,34 @@
 #include "fetcher.hpp"
 #include "security-options.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 namespace ndn::svs {
 
-Fetcher::Fetcher(Face& face, const SecurityOptions& securityOptions)
+static std::shared_ptr<const util::RttEstimator::Options>
+makeRttOptions(const FetcherOptions& options)
+{
+  auto rttOptions = std::make_shared<util::RttEstimator::Options>();
+  rttOptions->minRto = options.minRto;
+  rttOptions->maxRto = options.maxRto;
+  return rttOptions;
+}
+
+Fetcher::Fetcher(Face& face, const SecurityOptions& securityOptions, const FetcherOptions& options)
   : m_face(face)
   , m_scheduler(face.getIoContext())
   , m_securityOptions(securityOptions)
+  , m_options(options)
+  , m_rttOptions(makeRttOptions(options))
 {
+  // Producers create their windows on demand; check the options early
+  CongestionWindow window(options.window);
+
+  if (options.fairQuantum == 0)
+    NDN_THROW(Error("Fair quantum must be positive"));
+  if (options.maxPending == 0)
+    NDN_THROW(Error("Pending limit must be positive"));
 }
 
 void
@@ -32,75 +53,236 @@ Fetcher::expressInterest(const ndn::Interest& interest,
                          const ndn::NackCallback& afterNacked,
                          const ndn::TimeoutCallback& afterTimeout,
                          int nRetries,
-                         const ndn::security::DataValidationFailureCallback& afterValidationFailed)
-{
-  uint64_t id = ++m_interestIdCounter;
-  m_interestQueue.push({
-    id,
-    interest,
-    afterSatisfied,
-    afterNacked,
-    afterTimeout,
-    nRetries,
-    m_securityOptions.nRetriesOnValidationFail,
-    afterValidationFailed,
-  });
+                         const ndn::security::DataValidationFailureCallback& afterValidationFailed,
+                         const Name& producer,
+                         FetchPriority priority,
+                         bool isSpeculative)
+{
+  size_t slot = allocateSlot();
+  auto& qi = m_slots[slot];
+  qi.id = ++m_interestIdCounter;
+  qi.interest = interest;
+  qi.afterSatisfied = afterSatisfied;
+  qi.afterNacked = afterNacked;
+  qi.afterTimeout = afterTimeout;
+  qi.nRetries = nRetries;
+  qi.nRetriesOnValidationFail = m_securityOptions.nRetriesOnValidationFail;
+  qi.afterValidationFailed = afterValidationFailed;
+  qi.producer = &acquireProducer(producer);
+  qi.priority = priority;
+  qi.isSpeculative = isSpeculative;
+  qi.isRetransmission = false;
+
+  enqueue(slot);
   processQueue();
 }
 
 void
-Fetcher::expressInterest(const QueuedInterest& qi)
+Fetcher::retry(size_t slot)
 {
-  QueuedInterest qiNew(qi);
-  qiNew.id = ++m_interestIdCounter;
-
-  Interest newNonceInterest(qiNew.interest);
-  newNonceInterest.refreshNonce();
-  qiNew.interest = newNonceInterest;
+  auto& qi = m_slots[slot];
+  qi.id = ++m_interestIdCounter;
+  qi.isRetransmission = true;
+  qi.interest.refreshNonce();
 
-  m_interestQueue.push(qiNew);
+  enqueue(slot);
   processQueue();
 }
 
 void
 Fetcher::processQueue()
 {
-  while (!m_interestQueue.empty() && m_pendingInterests.size() < m_windowSize) {
-    QueuedInterest i = m_interestQueue.front();
-    m_interestQueue.pop();
+  while (auto slot = dequeue()) {
+    auto& qi = m_slots[*slot];
+    auto& producer = *qi.producer;
+
+    // Wait for the Data as long as the producer usually takes
+    if (m_options.adaptiveRto && !qi.isSpeculative && producer.rtt.hasSamples()) {
+      qi.interest.setInterestLifetime(std::chrono::ceil<time::milliseconds>(producer.rtt.getEstimatedRto()));
+    }
+    qi.sendTime = time::steady_clock::now();
+
+    // The callbacks only hold the slot, which fits in std::function without allocating
+    m_nPending++;
+    producer.nPending++;
+    qi.pendingInterest = m_face.expressInterest(
+      qi.interest,
+      [this, slot = *slot](const Interest& interest, const Data& data) { onData(interest, data, slot); },
+      [this, slot = *slot](const Interest& interest, const lp::Nack& nack) { onNack(interest, nack, slot); },
+      [this, slot = *slot](const Interest& interest) { onTimeout(interest, slot); });
+  }
+}
+
+size_t
+Fetcher::allocateSlot()
+{
+  if (m_freeSlots.empty()) {
+    m_slots.emplace_back();
+    return m_slots.size() - 1;
+  }
+
+  size_t slot = m_freeSlots.back();
+  m_freeSlots.pop_back();
+  return slot;
+}
+
+void
+Fetcher::releaseSlot(size_t slot)
+{
+  auto& qi = m_slots[slot];
+  qi.afterSatisfied = nullptr;
+  qi.afterNacked = nullptr;
+  qi.afterTimeout = nullptr;
+  qi.afterValidationFailed = nullptr;
+  releaseProducer(*qi.producer);
+  qi.producer = nullptr;
+  m_freeSlots.push_back(slot);
+}
+
+void
+Fetcher::enqueue(size_t slot)
+{
+  auto& qi = m_slots[slot];
+  auto& queue = m_interestQueues[static_cast<size_t>(qi.priority)];
+  auto& producerQueue = qi.producer->queues[static_cast<size_t>(qi.priority)];
 
-    m_pendingInterests[i.id] = m_face.expressInterest(i.interest,
-                                                      std::bind(&Fetcher::onData, this, _1, _2, i),
-                                                      std::bind(&Fetcher::onNack, this, _1, _2, i),
-                                                      std::bind(&Fetcher::onTimeout, this, _1, i));
+  // The producer takes its turn after the others of the class
+  if (producerQueue.size == 0) {
+    if (queue.tail == nullptr)
+      queue.head = qi.producer;
+    else
+      queue.tail->queues[static_cast<size_t>(qi.priority)].nextActive = qi.producer;
+    queue.tail = qi.producer;
   }
+
+  qi.next = NO_SLOT;
+  if (producerQueue.tail == NO_SLOT)
+    producerQueue.head = slot;
+  else
+    m_slots[producerQueue.tail].next = slot;
+  producerQueue.tail = slot;
+  producerQueue.size++;
+  queue.size++;
+}
+
+std::optional<size_t>
+Fetcher::dequeue()
+{
+  // Producers share the limit in the order of their turns
+  if (m_nPending >= m_options.maxPending)
+    return std::nullopt;
+
+  for (size_t priority = 0; priority < m_interestQueues.size(); priority++) {
+    auto& queue = m_interestQueues[priority];
+
+    // Producer whose turn it is; producers with a full window keep their turn
+    Producer* previous = nullptr;
+    Producer* producer = queue.head;
+    while (producer != nullptr && producer->nPending >= producer->window.getLimit()) {
+      previous = producer;
+      producer = producer->queues[priority].nextActive;
+    }
+    if (producer == nullptr)
+      continue;
+
+    auto& producerQueue = producer->queues[priority];
+    if (producerQueue.deficit == 0)
+      producerQueue.deficit = m_options.fairQuantum;
+
+    size_t slot = producerQueue.head;
+    producerQueue.head = m_slots[slot].next;
+    if (producerQueue.head == NO_SLOT)
+      producerQueue.tail = NO_SLOT;
+    producerQueue.size--;
+    producerQueue.deficit--;
+    queue.size--;
+
+    if (producerQueue.size > 0 && producerQueue.deficit > 0)
+      return slot;
+
+    // An idle producer does not keep the rest of its turn
+    if (producerQueue.size == 0)
+      producerQueue.deficit = 0;
+
+    // Unlink the producer, and append it again if it has more to send
+    Producer* next = producerQueue.nextActive;
+    producerQueue.nextActive = nullptr;
+    if (previous == nullptr)
+      queue.head = next;
+    else
+      previous->queues[priority].nextActive = next;
+    if (queue.tail == producer)
+      queue.tail = previous;
+
+    if (producerQueue.size > 0) {
+      if (queue.tail == nullptr)
+        queue.head = producer;
+      else
+        queue.tail->queues[priority].nextActive = producer;
+      queue.tail = producer;
+    }
+
+    return slot;
+  }
+
+  return std::nullopt;
 }
 
 void
-Fetcher::onData(const Interest& interest, const Data& data, const QueuedInterest& qi)
+Fetcher::onData(const Interest& interest, const Data& data, size_t slot)
 {
-  m_pendingInterests.erase(qi.id);
+  auto& qi = m_slots[slot];
+  // The face is done with the interest; canceling it would only post a no-op
+  qi.pendingInterest.release();
+  auto& producer = *qi.producer;
+  producer.window.onData(producer.nPending);
+  m_nPending--;
+  producer.nPending--;
+
+  // Speculative Data comes when it is published, not after a round trip
+  if (m_options.adaptiveRto && !qi.isRetransmission && !qi.isSpeculative) {
+    producer.rtt.addMeasurement(time::steady_clock::now() - qi.sendTime, producer.nPending + 1);
+  }
+
   processQueue();
 
+  // Callbacks may fetch again, so the slot is freed before they run
   if (m_securityOptions.validator == nullptr) {
     // No validator provided
-    qi.afterSatisfied(interest, data);
+    auto afterSatisfied = std::move(qi.afterSatisfied);
+    releaseSlot(slot);
+    afterSatisfied(interest, data);
   } else {
-    auto onDataValidated = [qi](const Data& data) { qi.afterSatisfied(qi.interest, data); };
+    auto onDataValidated = [this, slot](const Data& data) {
+      // The interest stays in the slot to be reused, so the slot is only
+      // freed after the callback; the slots of a deque stay in place if
+      // the callback fetches again
+      auto& qi = m_slots[slot];
+      auto afterSatisfied = std::move(qi.afterSatisfied);
+      try {
+        afterSatisfied(qi.interest, data);
+      }
+      catch (...) {
+        releaseSlot(slot);
+        throw;
+      }
+      releaseSlot(slot);
+    };
 
-    auto onValidationFailed = [this, qi](const Data& data, const ValidationError& error) {
+    auto onValidationFailed = [this, slot](const Data& data, const ValidationError& error) {
+      auto& qi = m_slots[slot];
       if (qi.nRetriesOnValidationFail > 0) {
+        qi.nRetriesOnValidationFail--;
         this->m_scheduler.schedule(
-          ndn::time::milliseconds(this->m_securityOptions.millisBeforeRetryOnValidationFail), [this, qi] {
-            QueuedInterest qiNew(qi);
-            qiNew.nRetriesOnValidationFail--;
-            this->expressInterest(qiNew);
-          });
+          ndn::time::milliseconds(this->m_securityOptions.millisBeforeRetryOnValidationFail),
+          [this, slot] { this->retry(slot); });
+        return;
       }
-      return;
 
-      if (qi.afterValidationFailed) {
-        qi.afterValidationFailed(data, error);
+      auto afterValidationFailed = std::move(qi.afterValidationFailed);
+      releaseSlot(slot);
+      if (afterValidationFailed) {
+        afterValidationFailed(data, error);
       }
     };
 
@@ -109,26 +291,179 @@ Fetcher::onData(const Interest& interest, const Data& data, const QueuedInterest
 }
 
 void
-Fetcher::onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack, const QueuedInterest& qi)
+Fetcher::onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack, size_t slot)
 {
-  m_pendingInterests.erase(qi.id);
+  auto& qi = m_slots[slot];
+  qi.pendingInterest.release();
+  m_nPending--;
+  qi.producer->nPending--;
+
+  // Other Nacks tell nothing about the capacity of the path
+  if (nack.getReason() == lp::NackReason::CONGESTION)
+    qi.producer->window.onCongestion(qi.id, m_interestIdCounter);
+
   processQueue();
-  qi.afterNacked(interest, nack);
+
+  auto afterNacked = std::move(qi.afterNacked);
+  releaseSlot(slot);
+  afterNacked(interest, nack);
 }
 
 void
-Fetcher::onTimeout(const Interest& interest, const QueuedInterest& qi)
+Fetcher::onTimeout(const Interest& interest, size_t slot)
 {
-  m_pendingInterests.erase(qi.id);
+  auto& qi = m_slots[slot];
+  qi.pendingInterest.release();
+  auto& producer = *qi.producer;
+  m_nPending--;
+  producer.nPending--;
+
+  // A retransmission is sent after the decrease for its first loss, so
+  // only first transmissions shrink the window, once per congestion event.
+  // The timeout is backed off on each loss of a retransmission.
+  // Unanswered speculative interests are not losses.
+  if (!qi.isSpeculative) {
+    bool isNewEvent = !qi.isRetransmission && producer.window.onCongestion(qi.id, m_interestIdCounter);
+    if ((isNewEvent || qi.isRetransmission) && m_options.adaptiveRto) {
+      producer.rtt.backoffRto();
+    }
+  }
 
   if (qi.nRetries == 0) {
     processQueue();
-    return qi.afterTimeout(interest);
+
+    auto afterTimeout = std::move(qi.afterTimeout);
+    releaseSlot(slot);
+    return afterTimeout(interest);
+  }
+
+  qi.nRetries--;
+  retry(slot);
+}
+
+size_t
+Fetcher::getQueueSize() const
+{
+  size_t size = 0;
+  for (const auto& queue : m_interestQueues)
+    size += queue.size;
+  return size;
+}
+
+size_t
+Fetcher::getQueueSize(const Name& producer) const
+{
+  auto state = findProducer(producer);
+  if (state == nullptr)
+    return 0;
+
+  size_t size = 0;
+  for (const auto& producerQueue : state->queues)
+    size += producerQueue.size;
+  return size;
+}
+
+std::map<Name, size_t>
+Fetcher::getQueueDepths() const
+{
+  std::map<Name, size_t> depths;
+  for (const auto& producer : m_producers) {
+    if (!producer)
+      continue;
+    for (const auto& producerQueue : producer->queues) {
+      if (producerQueue.size > 0)
+        depths[m_producerIds.getNodeId(producer->handle)] += producerQueue.size;
+    }
+  }
+  return depths;
+}
+
+std::optional<time::nanoseconds>
+Fetcher::getRto(const Name& producer) const
+{
+  auto state = findProducer(producer);
+  if (state == nullptr || !state->rtt.hasSamples())
+    return std::nullopt;
+  return state->rtt.getEstimatedRto();
+}
+
+double
+Fetcher::getWindow(const Name& producer) const
+{
+  auto state = findProducer(producer);
+  return state == nullptr ? m_options.window.initialWindow : state->window.getWindow();
+}
+
+size_t
+Fetcher::getPendingCount(const Name& producer) const
+{
+  auto state = findProducer(producer);
+  return state == nullptr ? 0 : state->nPending;
+}
+
+Fetcher::Producer&
+Fetcher::acquireProducer(const Name& name)
+{
+  NodeHandle handle = m_producerIds.intern(name);
+  if (m_producers.size() <= handle)
+    m_producers.resize(handle + 1);
+
+  auto& producer = m_producers[handle];
+  if (!producer)
+    producer.emplace(handle, m_options, m_rttOptions);
+  else if (producer->nRequests == 0)
+    unlinkIdle(*producer);
+
+  producer->nRequests++;
+  return *producer;
+}
+
+void
+Fetcher::releaseProducer(Producer& producer)
+{
+  if (--producer.nRequests > 0)
+    return;
+
+  producer.prevIdle = m_idleTail;
+  if (m_idleTail == nullptr)
+    m_idleHead = &producer;
+  else
+    m_idleTail->nextIdle = &producer;
+  m_idleTail = &producer;
+  m_nIdle++;
+
+  // Forget the least recently used; nothing refers to idle producers
+  while (m_nIdle > m_options.maxIdleProducers) {
+    NodeHandle handle = m_idleHead->handle;
+    unlinkIdle(*m_idleHead);
+    m_producers[handle].reset();
+    m_producerIds.release(handle);
   }
+}
 
-  QueuedInterest qiNew(qi);
-  qiNew.nRetries--;
-  expressInterest(qiNew);
+void
+Fetcher::unlinkIdle(Producer& producer)
+{
+  if (producer.prevIdle == nullptr)
+    m_idleHead = producer.nextIdle;
+  else
+    producer.prevIdle->nextIdle = producer.nextIdle;
+
+  if (producer.nextIdle == nullptr)
+    m_idleTail = producer.prevIdle;
+  else
+    producer.nextIdle->prevIdle = producer.prevIdle;
+
+  producer.prevIdle = nullptr;
+  producer.nextIdle = nullptr;
+  m_nIdle--;
+}
+
+const Fetcher::Producer*
+Fetcher::findProducer(const Name& producer) const
+{
+  auto handle = m_producerIds.find(producer);
+  return handle ? &*m_producers[*handle] : nullptr;
 }
 
 } // namespace ndn::svs
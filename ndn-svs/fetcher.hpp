@@ -18,68 +18,312 @@
 #define NDN_SVS_FETCHER_HPP
 
 #include "common.hpp"
+#include "congestion-window.hpp"
+#include "node-id-registry.hpp"
 #include "security-options.hpp"
 
+#include <ndn-cxx/util/rtt-estimator.hpp>
 #include <ndn-cxx/util/scheduler.hpp>
 
-#include <queue>
+#include <array>
+#include <deque>
+#include <limits>
+#include <optional>
 
 namespace ndn::svs {
 
+/**
+ * @brief Options for Fetcher constructor
+ */
+struct FetcherOptions
+{
+  /**
+   * @brief Window of outstanding interests of each producer.
+   *
+   * Each producer has its own window, which adapts to the path to the
+   * producer like TCP's AIMD, so an unreachable producer does not throttle
+   * the others.
+   */
+  CongestionWindowOptions window;
+
+  /**
+   * @brief Limit of interests in flight of all producers together.
+   *
+   * Producers within their windows share this limit round-robin, see
+   * fairQuantum.
+   */
+  size_t maxPending = 100;
+
+  /**
+   * @brief Set interest lifetimes from the estimated retransmission timeout.
+   *
+   * RTTs are estimated per producer. Until the first sample of a producer,
+   * or if disabled, the lifetime of the interest is used as is.
+   */
+  bool adaptiveRto = true;
+
+  /// @brief Lower bound of the retransmission timeout
+  time::milliseconds minRto = 200_ms;
+
+  /// @brief Upper bound of the retransmission timeout
+  time::milliseconds maxRto = 10_s;
+
+  /**
+   * @brief Interests sent for a producer in each round-robin turn.
+   *
+   * Producers with queued interests of the same class take turns for the
+   * shared limit of maxPending, so that a long backlog of one producer does
+   * not hold back the others.
+   */
+  size_t fairQuantum = 1;
+
+  /**
+   * @brief Producers without interests whose state is kept.
+   *
+   * The window and RTT estimate of a producer are kept while it has
+   * interests queued or in flight. Afterwards, the least recently used
+   * idle producers beyond this number are forgotten and start afresh.
+   */
+  size_t maxIdleProducers = 256;
+};
+
+/**
+ * @brief Priority class of a fetch
+ *
+ * Queued interests are sent in strict priority order. Within a class,
+ * producers are served round-robin, and the interests of one producer in
+ * the order they were expressed.
+ */
+enum class FetchPriority : uint8_t {
+  /// @brief Latency sensitive, e.g. mapping lookups and the newest publications
+  High,
+  /// @brief Default class
+  Normal,
+  /// @brief Background, e.g. bulk history catch-up
+  Low,
+};
+
 class Fetcher
 {
 public:
-  Fetcher(Face& face, const SecurityOptions& securityOptions);
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @throws CongestionWindow::Error if the window options are invalid
+   * @throws Error if the fair quantum or the pending limit is zero
+   */
+  Fetcher(Face& face, const SecurityOptions& securityOptions, const FetcherOptions& options = {});
 
+  /**
+   * @brief Express an interest once the window allows
+   *
+   * @param nRetries retransmissions on timeout, each with a backed off timeout
+   * @param producer producer of the data, whose window and RTT the interest is subject to
+   * @param priority class of the interest while waiting for the window;
+   *        retransmissions keep the class
+   * @param isSpeculative the data may not exist yet, e.g. when prefetching the
+   *        next publication; the lifetime is kept as is and a timeout is not
+   *        taken for a loss, so it does not shrink the window or back off the RTO
+   */
   void expressInterest(const ndn::Interest& interest,
                        const ndn::DataCallback& afterSatisfied,
                        const ndn::NackCallback& afterNacked,
                        const ndn::TimeoutCallback& afterTimeout,
                        int nRetries = 0,
-                       const ndn::security::DataValidationFailureCallback& afterValidationFailed = nullptr);
+                       const ndn::security::DataValidationFailureCallback& afterValidationFailed = nullptr,
+                       const Name& producer = Name(),
+                       FetchPriority priority = FetchPriority::Normal,
+                       bool isSpeculative = false);
 
-private:
-  struct QueuedInterest;
+  /**
+   * @brief Current retransmission timeout of a producer
+   * @returns nullopt if no RTT of the producer was measured
+   */
+  std::optional<time::nanoseconds> getRto(const Name& producer) const;
+
+  /// @brief Current congestion window of a producer, for monitoring
+  double getWindow(const Name& producer) const;
 
-  void expressInterest(const QueuedInterest& qi);
+  /// @brief Number of interests in flight
+  size_t getPendingCount() const
+  {
+    return m_nPending;
+  }
 
-  void onData(const Interest& interest, const Data& data, const QueuedInterest& qi);
+  /// @brief Number of interests of a producer in flight
+  size_t getPendingCount(const Name& producer) const;
 
-  void onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack, const QueuedInterest& qi);
+  /// @brief Number of interests waiting for the window
+  size_t getQueueSize() const;
+
+  /// @brief Number of interests of a class waiting for the window
+  size_t getQueueSize(FetchPriority priority) const
+  {
+    return m_interestQueues[static_cast<size_t>(priority)].size;
+  }
+
+  /// @brief Number of interests of a producer waiting for the window
+  size_t getQueueSize(const Name& producer) const;
+
+  /// @brief Number of interests waiting for the window, per producer
+  std::map<Name, size_t> getQueueDepths() const;
+
+private:
+  /// @brief Retransmit the interest of a slot with a new nonce
+  void retry(size_t slot);
 
-  void onTimeout(const Interest& interest, const QueuedInterest& qi);
+  void onData(const Interest& interest, const Data& data, size_t slot);
+
+  void onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack, size_t slot);
+
+  void onTimeout(const Interest& interest, size_t slot);
 
   void processQueue();
 
+  /// @brief Take a free slot, reusing released ones
+  size_t allocateSlot();
+
+  /**
+   * @brief Free a slot once its callbacks are done
+   *
+   * The interest stays in the slot, so that the next fetch reuses its storage.
+   */
+  void releaseSlot(size_t slot);
+
+  /// @brief Queue an interest behind the others of its class and producer
+  void enqueue(size_t slot);
+
+  /// @brief Take the slot of the next interest to send, if any
+  std::optional<size_t> dequeue();
+
+private:
+  static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+  struct Producer;
+
+  // Interests of one producer yet to be sent, in one class
+  struct ProducerQueue
+  {
+    // List of slots linked through QueuedInterest::next
+    size_t head = NO_SLOT;
+    size_t tail = NO_SLOT;
+    size_t size = 0;
+    // Interests left in the current turn (deficit round robin)
+    size_t deficit = 0;
+    // Next producer in the turns of the class, while interests are queued
+    Producer* nextActive = nullptr;
+  };
+
+  // Congestion control and queues of one producer
+  struct Producer
+  {
+    Producer(NodeHandle handle,
+             const FetcherOptions& options,
+             std::shared_ptr<const util::RttEstimator::Options> rttOptions)
+      : handle(handle)
+      , window(options.window)
+      , rtt(std::move(rttOptions))
+    {
+    }
+
+    const NodeHandle handle;
+
+    // Limit of pending interests, grows on Data and shrinks on congestion
+    CongestionWindow window;
+    util::RttEstimator rtt;
+    // Interests in flight, bounded by the window
+    size_t nPending = 0;
+    // Kept when drained, so queueing allocates nothing
+    std::array<ProducerQueue, static_cast<size_t>(FetchPriority::Low) + 1> queues;
+    // Slots referring to the producer, queued, in flight or being validated
+    size_t nRequests = 0;
+    // Neighbors in the list of idle producers, while nRequests is zero
+    Producer* prevIdle = nullptr;
+    Producer* nextIdle = nullptr;
+  };
+
+  // Producers with queued interests of one class, in the order of their turns
+  struct ClassQueue
+  {
+    Producer* head = nullptr;
+    Producer* tail = nullptr;
+    size_t size = 0;
+  };
+
+  /// @brief Get the state of a producer for a new request, creating it if needed
+  Producer& acquireProducer(const Name& producer);
+
+  /**
+   * @brief Drop a request of a producer
+   *
+   * A producer without requests becomes idle, and the least recently used
+   * idle producers beyond the limit are forgotten.
+   */
+  void releaseProducer(Producer& producer);
+
+  /// @brief Remove a producer from the list of idle producers
+  void unlinkIdle(Producer& producer);
+
+  /// @brief Get the state of a producer if it was used before
+  const Producer* findProducer(const Name& producer) const;
+
 private:
   Face& m_face;
   ndn::Scheduler m_scheduler;
   const SecurityOptions m_securityOptions;
+  const FetcherOptions m_options;
 
   uint64_t m_interestIdCounter = 0;
-  uint16_t m_windowSize = 10;
 
-  // Keep a scoped map of all pending interests.
-  // This ensures all interests are cancelled when
-  // the fetcher is destroyed.
-  // The size of this map represents the current window in progress.
-  std::map<uint64_t, ScopedPendingInterestHandle> m_pendingInterests;
+  // Producers are interned, and their state is indexed by handle. A deque
+  // keeps the state in place, so queues and slots point to it. Handles of
+  // forgotten producers are released and reused with their entries.
+  const std::shared_ptr<const util::RttEstimator::Options> m_rttOptions;
+  NodeIdRegistry m_producerIds;
+  std::deque<std::optional<Producer>> m_producers;
+  // Producers without requests, least recently used first
+  Producer* m_idleHead = nullptr;
+  Producer* m_idleTail = nullptr;
+  size_t m_nIdle = 0;
 
-  // An Interest and its callbacks
+  // An Interest and its callbacks, from the first transmission to the last callback
   struct QueuedInterest
   {
-    uint64_t id;
+    uint64_t id = 0;
     Interest interest;
     DataCallback afterSatisfied;
     NackCallback afterNacked;
     TimeoutCallback afterTimeout;
-    int nRetries;
-    int nRetriesOnValidationFail;
+    int nRetries = 0;
+    int nRetriesOnValidationFail = 0;
     ndn::security::DataValidationFailureCallback afterValidationFailed;
+    Producer* producer = nullptr;
+    FetchPriority priority = FetchPriority::Normal;
+    // Waits for data that may not exist yet, see expressInterest
+    bool isSpeculative = false;
+    // RTTs of retransmitted interests are ambiguous (Karn's algorithm)
+    bool isRetransmission = false;
+    time::steady_clock::time_point sendTime;
+    // Cancels the interest if the fetcher is destroyed
+    ScopedPendingInterestHandle pendingInterest;
+    // Next slot in the queue of the producer
+    size_t next = NO_SLOT;
   };
 
-  // Interests yet to be sent
-  std::queue<QueuedInterest> m_interestQueue;
+  // Requests are stored in reusable slots and referenced by index from the
+  // queues and the face callbacks, so a fetch is not copied along its way.
+  // A deque keeps the slots in place while the table grows.
+  std::deque<QueuedInterest> m_slots;
+  std::vector<size_t> m_freeSlots;
+  // Interests in flight of all producers, bounded by maxPending
+  size_t m_nPending = 0;
+
+  // Interests yet to be sent, per priority class
+  std::array<ClassQueue, static_cast<size_t>(FetchPriority::Low) + 1> m_interestQueues;
 };
 
 } // namespace ndn::svs
@@ -0,0 +1,90 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "hmac-context.hpp"
+
+#include <ndn-cxx/encoding/buffer-stream.hpp>
+#include <ndn-cxx/security/transform/bool-sink.hpp>
+#include <ndn-cxx/security/transform/buffer-source.hpp>
+#include <ndn-cxx/security/transform/signer-filter.hpp>
+#include <ndn-cxx/security/transform/stream-sink.hpp>
+#include <ndn-cxx/security/transform/verifier-filter.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+
+namespace ndn::svs {
+
+HmacContext::HmacContext(const security::SigningInfo& signingInfo)
+  : m_signingInfo(signingInfo)
+  , m_keyName(signingInfo.getSignerName())
+  , m_key(signingInfo.getHmacKey())
+{
+  if (signingInfo.getSignerType() != security::SigningInfo::SIGNER_TYPE_HMAC || !m_key)
+    NDN_THROW(Error("Signing info does not carry an HMAC key"));
+
+  // v0.2 signatures cover name components appended by the KeyChain
+  if (signingInfo.getSignedInterestFormat() != security::SignedInterestFormat::V03) {
+    m_keyChain = std::make_unique<KeyChain>("pib-memory:", "tpm-memory:");
+    m_keyChain->importPrivateKey(m_keyName, m_key);
+  }
+}
+
+void
+HmacContext::sign(Interest& interest) const
+{
+  using namespace security::transform;
+
+  if (m_keyChain) {
+    std::lock_guard<std::mutex> lock(m_keyChainMutex);
+    m_keyChain->sign(interest, m_signingInfo);
+    return;
+  }
+
+  // Fields set by the caller are kept, as KeyChain::sign does
+  SignatureInfo info = m_signingInfo.getSignatureInfo();
+  info.setSignatureType(tlv::SignatureHmacWithSha256);
+  info.setKeyLocator(KeyLocator(m_keyName));
+  interest.setSignatureInfo(info);
+
+  OBufferStream os;
+  bufferSource(interest.extractSignedRanges()) >> signerFilter(DigestAlgorithm::SHA256, *m_key) >>
+    streamSink(os);
+  interest.setSignatureValue(os.buf());
+}
+
+bool
+HmacContext::verify(const Interest& interest) const
+{
+  using namespace security::transform;
+
+  if (m_keyChain) {
+    std::lock_guard<std::mutex> lock(m_keyChainMutex);
+    return security::verifySignature(interest, m_keyChain->getTpm(), m_keyName, DigestAlgorithm::SHA256);
+  }
+
+  bool isValid = false;
+  try {
+    auto sig = interest.getSignatureValue();
+    bufferSource(interest.extractSignedRanges()) >>
+      verifierFilter(DigestAlgorithm::SHA256, *m_key, sig.value_bytes()) >> boolSink(isValid);
+  } catch (const std::exception&) {
+    // Not a signed interest
+    return false;
+  }
+  return isValid;
+}
+
+} // namespace ndn::svs
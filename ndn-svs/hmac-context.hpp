@@ -0,0 +1,75 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_HMAC_CONTEXT_HPP
+#define NDN_SVS_HMAC_CONTEXT_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-info.hpp>
+
+#include <mutex>
+
+namespace ndn::svs {
+
+/**
+ * @brief Prepared HMAC key to sign and verify sync interests
+ *
+ * The key is loaded once, instead of being looked up in a TPM for every
+ * interest. In the v0.3 signed interest format, interests are signed and
+ * verified with the key directly, and signatures are the same as those of
+ * KeyChain::sign with the same signing info. Interests in the v0.2 format
+ * are signed and verified with an in-memory KeyChain holding the key.
+ * All methods are thread-safe.
+ */
+class HmacContext : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @param signingInfo signing info with an HMAC key; the fields of its
+   *        SignatureInfo, e.g. nonce and time, are carried by every signature
+   * @throws Error if @p signingInfo does not carry an HMAC key
+   */
+  explicit HmacContext(const security::SigningInfo& signingInfo);
+
+  /// @brief Sign @p interest in the signed interest format of the signing info
+  void sign(Interest& interest) const;
+
+  /// @brief Verify the signature of @p interest
+  bool verify(const Interest& interest) const;
+
+private:
+  const security::SigningInfo m_signingInfo;
+  const Name m_keyName;
+  const std::shared_ptr<security::transform::PrivateKey> m_key;
+
+  // Signs and verifies v0.2 signed interests, whose signatures cover the
+  // name; not thread-safe, so guarded by the mutex
+  std::unique_ptr<KeyChain> m_keyChain;
+  mutable std::mutex m_keyChainMutex;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_HMAC_CONTEXT_HPP
@@ -17,6 +17,8 @@
 #include "mapping-provider.hpp"
 #include "tlv.hpp"
 
+#include <limits>
+
 namespace ndn::svs {
 
 MappingList::MappingList() = default;
@@ -88,12 +90,16 @@ MappingList::encode() const
 MappingProvider::MappingProvider(const Name& syncPrefix,
                                  const NodeID& id,
                                  ndn::Face& face,
-                                 const SecurityOptions& securityOptions)
+                                 const SecurityOptions& securityOptions,
+                                 std::shared_ptr<NodeIdRegistry> nodeIdRegistry,
+                                 Fetcher* fetcher)
   : m_syncPrefix(syncPrefix)
   , m_id(id)
   , m_face(face)
-  , m_fetcher(face, securityOptions)
   , m_securityOptions(securityOptions)
+  , m_ownFetcher(fetcher ? nullptr : std::make_unique<Fetcher>(face, securityOptions))
+  , m_fetcher(fetcher ? *fetcher : *m_ownFetcher)
+  , m_nodeIdRegistry(nodeIdRegistry ? std::move(nodeIdRegistry) : std::make_shared<NodeIdRegistry>())
 {
   m_registeredPrefix = m_face.setInterestFilter(Name(m_id).append(m_syncPrefix).append("MAPPING"),
                                                 std::bind(&MappingProvider::onMappingQuery, this, _2),
@@ -103,13 +109,30 @@ MappingProvider::MappingProvider(const Name& syncPrefix,
 void
 MappingProvider::insertMapping(const NodeID& nodeId, const SeqNo& seqNo, const MappingEntryPair& entry)
 {
-  m_map[Name(nodeId).appendNumber(seqNo)] = entry;
+  m_map[std::pair(m_nodeIdRegistry->intern(nodeId), seqNo)] = entry;
 }
 
 MappingEntryPair
 MappingProvider::getMapping(const NodeID& nodeId, const SeqNo& seqNo)
 {
-  return m_map.at(Name(nodeId).appendNumber(seqNo));
+  auto handle = m_nodeIdRegistry->find(nodeId);
+  if (!handle)
+    NDN_THROW(std::out_of_range("Unknown NodeID"));
+
+  return getMapping(*handle, seqNo);
+}
+
+MappingEntryPair
+MappingProvider::getMapping(NodeHandle nodeHandle, const SeqNo& seqNo)
+{
+  return m_map.at(std::pair(nodeHandle, seqNo));
+}
+
+void
+MappingProvider::eraseMappings(NodeHandle nodeHandle)
+{
+  m_map.erase(m_map.lower_bound(std::pair(nodeHandle, SeqNo(0))),
+              m_map.upper_bound(std::pair(nodeHandle, std::numeric_limits<SeqNo>::max())));
 }
 
 void
@@ -160,6 +183,7 @@ MappingProvider::fetchNameMapping(const MissingDataInfo& info,
   Interest interest(queryName);
   interest.setCanBePrefix(false);
   interest.setMustBeFresh(false);
+  // Until the RTT to the producer is known
   interest.setInterestLifetime(2_s);
 
   auto onDataValidated = [this, onValidated, info](const Data& data) {
@@ -178,12 +202,15 @@ MappingProvider::fetchNameMapping(const MissingDataInfo& info,
     onValidated(list);
   };
 
+  // Publications wait for their mapping, so it goes first
   m_fetcher.expressInterest(interest,
                             std::bind(onDataValidated, _2),
                             std::bind(onTimeout, _1), // Nack
                             onTimeout,
                             nRetries,
-                            [](auto&&...) {});
+                            [](auto&&...) {},
+                            info.nodeId,
+                            FetchPriority::High);
 }
 
 Name
@@ -53,10 +53,20 @@ public:
 class MappingProvider : noncopyable
 {
 public:
+  /**
+   * @param nodeIdRegistry NodeID interning table; a private one is
+   *        created if not specified.
+   * @param fetcher Fetcher shared with the data of the group, so that
+   *        mapping lookups are ranked against data fetches and use the same
+   *        windows; a private one is created if not specified. It must
+   *        outlive the provider.
+   */
   MappingProvider(const Name& syncPrefix,
                   const NodeID& id,
                   ndn::Face& face,
-                  const SecurityOptions& securityOptions);
+                  const SecurityOptions& securityOptions,
+                  std::shared_ptr<NodeIdRegistry> nodeIdRegistry = nullptr,
+                  Fetcher* fetcher = nullptr);
 
   virtual ~MappingProvider() = default;
 
@@ -74,6 +84,16 @@ public:
    */
   MappingEntryPair getMapping(const NodeID& nodeId, const SeqNo& seqNo);
 
+  /**
+   * @brief Get a mapping by interned NodeID and throw if not found
+   */
+  MappingEntryPair getMapping(NodeHandle nodeHandle, const SeqNo& seqNo);
+
+  /**
+   * @brief Remove all mappings of a node, e.g. before its handle is released
+   */
+  void eraseMappings(NodeHandle nodeHandle);
+
   /**
    * @brief Retrieve the data mappings for encapsulated data packets
    *
@@ -113,12 +133,15 @@ private:
   const Name m_syncPrefix;
   const NodeID m_id;
   Face& m_face;
-  Fetcher m_fetcher;
   const SecurityOptions m_securityOptions;
+  // Set if no fetcher is shared
+  std::unique_ptr<Fetcher> m_ownFetcher;
+  Fetcher& m_fetcher;
 
   ndn::ScopedRegisteredPrefixHandle m_registeredPrefix;
 
-  std::map<Name, MappingEntryPair> m_map;
+  const std::shared_ptr<NodeIdRegistry> m_nodeIdRegistry;
+  std::map<std::pair<NodeHandle, SeqNo>, MappingEntryPair> m_map;
 };
 
 } // namespace ndn::svs
@@ -0,0 +1,87 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "node-id-registry.hpp"
+
+namespace ndn::svs {
+
+NodeHandle
+NodeIdRegistry::intern(const NodeID& nid)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto it = m_handles.find(nid);
+  if (it != m_handles.end())
+    return it->second;
+
+  NodeHandle handle;
+  if (m_freeHandles.empty()) {
+    handle = static_cast<NodeHandle>(m_nodeIds.size());
+    m_nodeIds.emplace_back(nid);
+  } else {
+    handle = m_freeHandles.back();
+    m_freeHandles.pop_back();
+    m_nodeIds[handle] = nid;
+  }
+
+  m_handles.emplace(nid, handle);
+  return handle;
+}
+
+std::optional<NodeHandle>
+NodeIdRegistry::find(const NodeID& nid) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto it = m_handles.find(nid);
+  if (it == m_handles.end())
+    return std::nullopt;
+  return it->second;
+}
+
+const NodeID&
+NodeIdRegistry::getNodeId(NodeHandle handle) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto& nid = m_nodeIds.at(handle);
+  if (!nid)
+    NDN_THROW(std::out_of_range("Released NodeHandle"));
+  return *nid;
+}
+
+bool
+NodeIdRegistry::release(NodeHandle handle)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (handle >= m_nodeIds.size() || !m_nodeIds[handle])
+    return false;
+
+  m_handles.erase(*m_nodeIds[handle]);
+  m_nodeIds[handle].reset();
+  m_freeHandles.push_back(handle);
+  return true;
+}
+
+size_t
+NodeIdRegistry::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_handles.size();
+}
+
+} // namespace ndn::svs
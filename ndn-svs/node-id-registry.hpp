@@ -0,0 +1,97 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_NODE_ID_REGISTRY_HPP
+#define NDN_SVS_NODE_ID_REGISTRY_HPP
+
+#include "common.hpp"
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ndn::svs {
+
+/**
+ * @brief Dense integer handle of an interned NodeID
+ *
+ * Handles are assigned in order starting from zero, so they can be used to
+ * index flat tables and compared as integers. Released handles are
+ * assigned again to later NodeIDs.
+ */
+using NodeHandle = uint32_t;
+
+/**
+ * @brief Interning table mapping each NodeID to a NodeHandle
+ *
+ * The table is shared between the sync core, pub/sub and the mapping
+ * provider so that a handle refers to the same node everywhere.
+ * All methods are thread-safe.
+ */
+class NodeIdRegistry : noncopyable
+{
+public:
+  /**
+   * @brief Get the handle of @p nid, assigning a new one on first use
+   */
+  NodeHandle intern(const NodeID& nid);
+
+  /**
+   * @brief Get the handle of @p nid if it was interned before
+   */
+  std::optional<NodeHandle> find(const NodeID& nid) const;
+
+  /**
+   * @brief Get the NodeID of a handle
+   *
+   * The returned reference stays valid until the handle is released.
+   *
+   * @throws std::out_of_range the handle is not assigned
+   */
+  const NodeID& getNodeId(NodeHandle handle) const;
+
+  /**
+   * @brief Forget the NodeID of a handle, so that the handle can be reused
+   *
+   * All tables using the handle must have dropped it, as a later intern()
+   * may assign it to a different NodeID.
+   *
+   * @returns whether the handle was assigned
+   */
+  bool release(NodeHandle handle);
+
+  /// @brief Number of interned NodeIDs
+  size_t size() const;
+
+public:
+  static constexpr NodeHandle INVALID_HANDLE = std::numeric_limits<NodeHandle>::max();
+
+private:
+  // Indexed by handle; std::deque does not move elements on push_back
+  std::deque<std::optional<NodeID>> m_nodeIds;
+  std::unordered_map<NodeID, NodeHandle> m_handles;
+  // Released handles, reused before new ones are assigned
+  std::vector<NodeHandle> m_freeHandles;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_NODE_ID_REGISTRY_HPP
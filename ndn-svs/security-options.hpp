@@ -52,6 +52,23 @@ public:
   {
     successCb(interest);
   }
+
+  /**
+   * @brief Find the public key that must have signed @p interest
+   *
+   * A validator that can tell the key of a sync interest from its trust
+   * policy, e.g. from a certificate it already holds, returns the key
+   * without verifying the signature. The signature is then verified with
+   * ndn::security::verifySignature on the validation threads of the sync
+   * core, while the lookup stays on the thread of the face.
+   *
+   * @returns public key in DER format, or nullptr to validate the interest
+   *          with validate() on the thread of the face (default)
+   */
+  virtual ConstBufferPtr getVerificationKey(const Interest& interest)
+  {
+    return nullptr;
+  }
 };
 
 /**
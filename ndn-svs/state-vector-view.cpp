@@ -0,0 +1,154 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "state-vector-view.hpp"
+#include "tlv.hpp"
+
+#include <limits>
+
+namespace ndn::svs {
+
+/**
+ * @brief Read the TLV at @p pos and advance past it
+ * @returns TLV-VALUE of the element
+ */
+static span<const uint8_t>
+readElement(const uint8_t*& pos, const uint8_t* end, uint32_t& type)
+{
+  uint64_t length = 0;
+  if (!ndn::tlv::readType(pos, end, type) || !ndn::tlv::readVarNumber(pos, end, length) ||
+      length > static_cast<uint64_t>(end - pos))
+    NDN_THROW(ndn::tlv::Error("Malformed TLV element in StateVector"));
+
+  span<const uint8_t> value(pos, static_cast<size_t>(length));
+  pos += length;
+  return value;
+}
+
+/**
+ * @brief Check that the name components in @p value are decodable
+ */
+static void
+validateNameComponents(span<const uint8_t> value)
+{
+  const uint8_t* pos = value.data();
+  const uint8_t* end = pos + value.size();
+
+  while (pos < end) {
+    uint32_t type = 0;
+    auto compValue = readElement(pos, end, type);
+
+    if (type == 0 || type > std::numeric_limits<uint16_t>::max())
+      NDN_THROW(ndn::tlv::Error("Name component type out of range"));
+
+    if ((type == ndn::tlv::ImplicitSha256DigestComponent ||
+         type == ndn::tlv::ParametersSha256DigestComponent) &&
+        compValue.size() != 32)
+      NDN_THROW(ndn::tlv::Error("Digest name component must be 32 octets"));
+  }
+}
+
+StateVectorView::StateVectorView(const ndn::Block& block)
+  : m_block(block)
+{
+  if (block.type() != tlv::StateVector)
+    NDN_THROW(ndn::tlv::Error("StateVector", block.type()));
+
+  const uint8_t* pos = block.value();
+  const uint8_t* end = pos + block.value_size();
+
+  while (pos < end) {
+    uint32_t type = 0;
+    auto entryValue = readElement(pos, end, type);
+    if (type != tlv::StateVectorEntry)
+      NDN_THROW(ndn::tlv::Error("StateVectorEntry", type));
+
+    const uint8_t* entryPos = entryValue.data();
+    const uint8_t* entryEnd = entryPos + entryValue.size();
+
+    // NodeID (Name)
+    const uint8_t* nameBegin = entryPos;
+    auto nameValue = readElement(entryPos, entryEnd, type);
+    if (type != ndn::tlv::Name)
+      NDN_THROW(ndn::tlv::Error("Name", type));
+    validateNameComponents(nameValue);
+    span<const uint8_t> nameWire(nameBegin, static_cast<size_t>(entryPos - nameBegin));
+
+    // SeqNo
+    auto seqValue = readElement(entryPos, entryEnd, type);
+    if (type != tlv::SeqNo)
+      NDN_THROW(ndn::tlv::Error("SeqNo", type));
+    auto seqPos = seqValue.data();
+    SeqNo seqNo = ndn::tlv::readNonNegativeInteger(seqValue.size(), seqPos, seqPos + seqValue.size());
+
+    if (!m_entries.empty() && !lessNodeId(m_entries.back().nodeIdValue, nameValue))
+      m_isSorted = false;
+
+    m_entries.push_back({ nameWire, nameValue, seqNo });
+    m_digest += hashEntry(hashNodeId(nameValue), seqNo);
+  }
+}
+
+SeqNo
+StateVectorView::get(const NodeID& nid) const
+{
+  auto value = nid.wireEncode().value_bytes();
+
+  if (m_isSorted) {
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), value,
+                               [](const Entry& entry, span<const uint8_t> v) {
+                                 return lessNodeId(entry.nodeIdValue, v);
+                               });
+    return it != m_entries.end() && equalNodeId(it->nodeIdValue, value) ? it->seqNo : 0;
+  }
+
+  for (const auto& entry : m_entries) {
+    if (equalNodeId(entry.nodeIdValue, value))
+      return entry.seqNo;
+  }
+  return 0;
+}
+
+uint64_t
+StateVectorView::hashNodeId(span<const uint8_t> nodeIdValue) noexcept
+{
+  // FNV-1a
+  uint64_t hash = 0xcbf29ce484222325;
+  for (uint8_t byte : nodeIdValue) {
+    hash ^= byte;
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+uint64_t
+StateVectorView::hashEntry(uint64_t nodeIdHash, SeqNo seqNo) noexcept
+{
+  // splitmix64 finalizer, so that sums of entry hashes do not cancel out
+  uint64_t x = nodeIdHash + seqNo * 0x9e3779b97f4a7c15;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+  return x ^ (x >> 31);
+}
+
+NodeID
+StateVectorView::Entry::getNodeId() const
+{
+  return NodeID(ndn::Block(nodeIdWire));
+}
+
+} // namespace ndn::svs
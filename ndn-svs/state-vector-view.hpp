@@ -0,0 +1,154 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_STATE_VECTOR_VIEW_HPP
+#define NDN_SVS_STATE_VECTOR_VIEW_HPP
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ndn::svs {
+
+/**
+ * @brief Read-only view of an encoded StateVector
+ *
+ * The TLV is walked and validated once on construction, but entries
+ * refer to the wire encoding in place; no NodeID is decoded unless
+ * Entry::getNodeId() is called.
+ */
+class StateVectorView
+{
+public:
+  struct Entry
+  {
+    /// @brief Wire encoding of the NodeID (Name TLV)
+    span<const uint8_t> nodeIdWire;
+    /// @brief TLV-VALUE of the NodeID, i.e. the encoded name components
+    span<const uint8_t> nodeIdValue;
+    /// @brief Sequence number of the entry
+    SeqNo seqNo;
+
+    /// @brief Decode the NodeID of this entry
+    NodeID getNodeId() const;
+  };
+
+  using const_iterator = std::vector<Entry>::const_iterator;
+
+  /**
+   * @brief Create a view of a StateVector block
+   *
+   * The view keeps a reference to the underlying buffer of @p encoded.
+   *
+   * @throws ndn::tlv::Error the block is not a well-formed StateVector
+   */
+  explicit StateVectorView(const ndn::Block& encoded);
+
+  /**
+   * @brief Get the sequence number of @p nid, or 0 if not present
+   */
+  SeqNo get(const NodeID& nid) const;
+
+  const_iterator begin() const noexcept
+  {
+    return m_entries.begin();
+  }
+
+  const_iterator end() const noexcept
+  {
+    return m_entries.end();
+  }
+
+  size_t size() const noexcept
+  {
+    return m_entries.size();
+  }
+
+  /// @brief Whether the entries are in strictly increasing NodeID order
+  bool isSorted() const noexcept
+  {
+    return m_isSorted;
+  }
+
+  /// @brief Get the viewed block
+  const ndn::Block& getBlock() const noexcept
+  {
+    return m_block;
+  }
+
+  /**
+   * @brief Get the order-independent digest of the entries
+   *
+   * Equal vectors have equal digests, see VersionVector::getDigest().
+   */
+  uint64_t getDigest() const noexcept
+  {
+    return m_digest;
+  }
+
+  /**
+   * @brief Compare two encoded NodeIDs by their TLV-VALUEs
+   *
+   * The lexicographic order of the encoded components of two names is the
+   * same as the canonical order of the names, so this matches NodeID::compare.
+   */
+  static bool lessNodeId(span<const uint8_t> lhs, span<const uint8_t> rhs)
+  {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  /**
+   * @brief Three-way comparison of two encoded NodeIDs by their TLV-VALUEs
+   * @returns negative, zero or positive, like NodeID::compare
+   */
+  static int compareNodeId(span<const uint8_t> lhs, span<const uint8_t> rhs)
+  {
+    size_t common = std::min(lhs.size(), rhs.size());
+    int cmp = common == 0 ? 0 : std::memcmp(lhs.data(), rhs.data(), common);
+    if (cmp != 0)
+      return cmp;
+    return lhs.size() < rhs.size() ? -1 : lhs.size() > rhs.size() ? 1 : 0;
+  }
+
+  /// @brief Check if two encoded NodeIDs are equal
+  static bool equalNodeId(span<const uint8_t> lhs, span<const uint8_t> rhs)
+  {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  /// @brief Hash the TLV-VALUE of an encoded NodeID
+  static uint64_t hashNodeId(span<const uint8_t> nodeIdValue) noexcept;
+
+  /**
+   * @brief Hash a single entry for the vector digest
+   *
+   * The digest of a vector is the sum of the hashes of its entries, so it
+   * can be updated in place when a single entry changes.
+   */
+  static uint64_t hashEntry(uint64_t nodeIdHash, SeqNo seqNo) noexcept;
+
+private:
+  ndn::Block m_block;
+  std::vector<Entry> m_entries;
+  bool m_isSorted = true;
+  uint64_t m_digest = 0;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_STATE_VECTOR_VIEW_HPP
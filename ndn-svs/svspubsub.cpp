@@ -39,11 +39,20 @@ SVSPubSub::SVSPubSub(const Name& syncPrefix,
              face,
              std::bind(&SVSPubSub::updateCallbackInternal, this, _1),
              securityOptions,
-             options.dataStore)
-  , m_mappingProvider(syncPrefix, nodePrefix, face, securityOptions)
+             options.dataStore,
+             options.coreOptions,
+             options.fetcherOptions)
+  , m_mappingProvider(syncPrefix,
+                      nodePrefix,
+                      face,
+                      securityOptions,
+                      m_svsync.getCore().getNodeIdRegistry(),
+                      &m_svsync.getFetcher())
+  , m_nodeIdRegistry(m_svsync.getCore().getNodeIdRegistry())
 {
   m_svsync.getCore().setGetExtraBlockCallback(std::bind(&SVSPubSub::onGetExtraData, this, _1));
-  m_svsync.getCore().setRecvExtraBlockCallback(std::bind(&SVSPubSub::onRecvExtraData, this, _1));
+  m_svsync.getCore().setRecvExtraBlockViewCallback(std::bind(&SVSPubSub::onRecvExtraData, this, _1));
+  m_svsync.getCore().setPruneCallback(std::bind(&SVSPubSub::onPruneMember, this, _2));
 }
 
 SeqNo
@@ -177,11 +186,14 @@ SVSPubSub::updateCallbackInternal(const std::vector<MissingDataInfo>& info)
       if (sub.prefix.isPrefixOf(streamName)) {
         // Add to fetching queue
         for (SeqNo i = stream.low; i <= stream.high; i++)
-          m_fetchMap[std::pair(stream.nodeId, i)].push_back(sub);
+          m_fetchMap[std::pair(stream.nodeHandle, i)].push_back(sub);
 
-        // Prefetch next available data
-        if (sub.prefetch)
-          m_svsync.fetchData(stream.nodeId, stream.high + 1, [](auto&&...) {}); // do nothing with prefetch
+        // Prefetch next available data, which may take longer than the RTT to be published
+        if (sub.prefetch) {
+          auto ignore = [](auto&&...) {}; // do nothing with prefetch
+          m_svsync.fetchData(stream.nodeId, stream.high + 1, ignore, ignore, ignore, 0,
+                             FetchPriority::Low, true);
+        }
       }
     }
 
@@ -195,7 +207,7 @@ SVSPubSub::updateCallbackInternal(const std::vector<MissingDataInfo>& info)
       for (SeqNo i = remainingInfo.low; i <= remainingInfo.high; i++) {
         try {
           // throws if mapping not found
-          this->processMapping(stream.nodeId, i);
+          this->processMapping(stream.nodeHandle, i);
           remainingInfo.low++;
         } catch (const std::exception&) {
           break;
@@ -214,10 +226,16 @@ SVSPubSub::updateCallbackInternal(const std::vector<MissingDataInfo>& info)
 
         m_mappingProvider.fetchNameMapping(
           truncatedRemainingInfo,
-          [this, remainingInfo, streamName](const MappingList& list) {
+          [this, nodeId = stream.nodeId](const MappingList& list) {
+            // The member may have been pruned meanwhile, and its handle
+            // assigned to another NodeID, so the handle is looked up again
+            auto handle = m_nodeIdRegistry->find(nodeId);
+            if (!handle)
+              return;
+
             bool queued = false;
             for (const auto& [seq, mapping] : list.pairs)
-              queued |= this->processMapping(streamName, seq);
+              queued |= this->processMapping(*handle, seq);
 
             if (queued)
               this->fetchAll();
@@ -234,10 +252,10 @@ SVSPubSub::updateCallbackInternal(const std::vector<MissingDataInfo>& info)
 }
 
 bool
-SVSPubSub::processMapping(const NodeID& nodeId, SeqNo seqNo)
+SVSPubSub::processMapping(NodeHandle nodeHandle, SeqNo seqNo)
 {
   // this will throw if mapping not found
-  auto mapping = m_mappingProvider.getMapping(nodeId, seqNo);
+  auto mapping = m_mappingProvider.getMapping(nodeHandle, seqNo);
 
   // check if timestamp is too old
   if (m_opts.maxPubAge > 0_ms) {
@@ -263,7 +281,7 @@ SVSPubSub::processMapping(const NodeID& nodeId, SeqNo seqNo)
   bool queued = false;
   for (const auto& sub : m_prefixSubscriptions) {
     if (sub.prefix.isPrefixOf(mapping.first)) {
-      m_fetchMap[std::pair(nodeId, seqNo)].push_back(sub);
+      m_fetchMap[std::pair(nodeHandle, seqNo)].push_back(sub);
       queued = true;
     }
   }
@@ -282,13 +300,13 @@ SVSPubSub::fetchAll()
     m_fetchingMap[key] = true;
 
     // Fetch first data packet
-    const auto& [nodeId, seqNo] = key;
-    m_svsync.fetchData(nodeId, seqNo, std::bind(&SVSPubSub::onSyncData, this, _1, key), 12);
+    const auto& [nodeHandle, seqNo] = key;
+    m_svsync.fetchData(m_nodeIdRegistry->getNodeId(nodeHandle), seqNo, std::bind(&SVSPubSub::onSyncData, this, _1, key), 12);
   }
 }
 
 void
-SVSPubSub::onSyncData(const Data& firstData, const std::pair<Name, SeqNo>& publication)
+SVSPubSub::onSyncData(const Data& firstData, const std::pair<NodeHandle, SeqNo>& publication)
 {
   // Make sure the data is encapsulated
   if (firstData.getContentType() != ndn::tlv::Data) {
@@ -301,8 +319,9 @@ SVSPubSub::onSyncData(const Data& firstData, const std::pair<Name, SeqNo>& publi
   auto innerContent = innerData.getContent();
 
   // Return data to packet subscriptions
+  const NodeID& producer = m_nodeIdRegistry->getNodeId(publication.first);
   SubscriptionData subData = {
-    innerData.getName(), innerContent.value_bytes(), publication.first, publication.second, innerData,
+    innerData.getName(), innerContent.value_bytes(), producer, publication.second, innerData,
   };
 
   // Function to return data to subscriptions
@@ -361,8 +380,9 @@ SVSPubSub::onSyncData(const Data& firstData, const std::pair<Name, SeqNo>& publi
               finalBuffer->resize(*bufSize);
 
               // Return data to packet subscriptions
+              const NodeID& producer = this->m_nodeIdRegistry->getNodeId(publication.first);
               SubscriptionData subData = {
-                innerName, *finalBuffer, publication.first, publication.second, std::nullopt,
+                innerName, *finalBuffer, producer, publication.second, std::nullopt,
               };
 
               for (const auto& sub : this->m_fetchMap[publication])
@@ -418,12 +438,28 @@ SVSPubSub::onSyncData(const Data& firstData, const std::pair<Name, SeqNo>& publi
 }
 
 void
-SVSPubSub::cleanUpFetch(const std::pair<Name, SeqNo>& publication)
+SVSPubSub::cleanUpFetch(const std::pair<NodeHandle, SeqNo>& publication)
 {
   m_fetchMap.erase(publication);
   m_fetchingMap.erase(publication);
 }
 
+bool
+SVSPubSub::onPruneMember(NodeHandle nodeHandle)
+{
+  // Keep the handle while publications of the member are being fetched;
+  // mapping fetches look up the handle of the member when they complete
+  auto isFetching = [nodeHandle](const auto& map) {
+    auto it = map.lower_bound(std::pair(nodeHandle, SeqNo(0)));
+    return it != map.end() && it->first.first == nodeHandle;
+  };
+  if (isFetching(m_fetchMap) || isFetching(m_fetchingMap))
+    return false;
+
+  m_mappingProvider.eraseMappings(nodeHandle);
+  return true;
+}
+
 Block
 SVSPubSub::onGetExtraData(const VersionVector&)
 {
@@ -49,6 +49,12 @@ struct SVSPubSubOptions
    * The useTimestamp option should be enabled for this to work.
    */
   time::milliseconds maxPubAge = 0_ms;
+
+  /// @brief Timer options of the underlying sync
+  SyncCoreOptions coreOptions;
+
+  /// @brief Window and timeout options of the fetcher of publications and mappings
+  FetcherOptions fetcherOptions;
 };
 
 /**
@@ -181,7 +187,7 @@ private:
     bool prefetch;
   };
 
-  void onSyncData(const Data& syncData, const std::pair<Name, SeqNo>& publication);
+  void onSyncData(const Data& syncData, const std::pair<NodeHandle, SeqNo>& publication);
 
   void updateCallbackInternal(const std::vector<MissingDataInfo>& info);
 
@@ -189,6 +195,9 @@ private:
 
   void onRecvExtraData(const Block& block);
 
+  /// @brief Drop the mappings of a pruned member, unless it is still being fetched
+  bool onPruneMember(NodeHandle nodeHandle);
+
   /// @brief Insert a mapping entry into the store
   void insertMapping(const NodeID& nid, SeqNo seqNo, const Name& name, std::vector<Block> additional);
 
@@ -197,11 +206,11 @@ private:
    * @returns true if new publications were queued for fetch
    * @throws std::exception error if mapping is not found
    */
-  bool processMapping(const NodeID& nodeId, SeqNo seqNo);
+  bool processMapping(NodeHandle nodeHandle, SeqNo seqNo);
 
   void fetchAll();
 
-  void cleanUpFetch(const std::pair<Name, SeqNo>& publication);
+  void cleanUpFetch(const std::pair<NodeHandle, SeqNo>& publication);
 
 public:
   static inline const Name EMPTY_NAME;
@@ -231,9 +240,12 @@ private:
   std::vector<Subscription> m_producerSubscriptions;
   std::vector<Subscription> m_prefixSubscriptions;
 
-  // Queue of publications to fetch
-  std::map<std::pair<Name, SeqNo>, std::vector<Subscription>> m_fetchMap;
-  std::map<std::pair<Name, SeqNo>, bool> m_fetchingMap;
+  // Interned NodeIDs shared with the sync core and mapping provider
+  const std::shared_ptr<NodeIdRegistry> m_nodeIdRegistry;
+
+  // Queue of publications to fetch, keyed by interned NodeID
+  std::map<std::pair<NodeHandle, SeqNo>, std::vector<Subscription>> m_fetchMap;
+  std::map<std::pair<NodeHandle, SeqNo>, bool> m_fetchingMap;
 };
 
 } // namespace ndn::svs
@@ -27,16 +27,18 @@ SVSyncBase::SVSyncBase(const Name& syncPrefix,
                        ndn::Face& face,
                        const UpdateCallback& updateCallback,
                        const SecurityOptions& securityOptions,
-                       std::shared_ptr<DataStore> dataStore)
+                       std::shared_ptr<DataStore> dataStore,
+                       const SyncCoreOptions& coreOptions,
+                       const FetcherOptions& fetcherOptions)
   : m_syncPrefix(syncPrefix)
   , m_dataPrefix(dataPrefix)
   , m_securityOptions(securityOptions)
   , m_id(id)
   , m_face(face)
-  , m_fetcher(face, securityOptions)
+  , m_fetcher(face, securityOptions, fetcherOptions)
   , m_onUpdate(updateCallback)
   , m_dataStore(std::move(dataStore))
-  , m_core(m_face, m_syncPrefix, m_onUpdate, securityOptions, m_id)
+  , m_core(m_face, m_syncPrefix, m_onUpdate, securityOptions, m_id, coreOptions)
 {
   // Register new data store
   if (m_dataStore == DEFAULT_DATASTORE)
@@ -60,7 +62,8 @@ SeqNo
 SVSyncBase::publishData(const Block& content,
                         const ndn::time::milliseconds& freshness,
                         const NodeID& id,
-                        uint32_t contentType)
+                        uint32_t contentType,
+                        bool urgent)
 {
   NodeID pubId = id != EMPTY_NODE_ID ? id : m_id;
   SeqNo newSeq = m_core.getSeqNo(pubId) + 1;
@@ -74,7 +77,7 @@ SVSyncBase::publishData(const Block& content,
   m_securityOptions.dataSigner->sign(*data);
 
   m_dataStore->insert(*data);
-  m_core.updateSeqNo(newSeq, pubId);
+  m_core.updateSeqNo(newSeq, pubId, urgent);
   m_face.put(*data);
 
   return newSeq;
@@ -125,19 +128,35 @@ SVSyncBase::fetchData(const NodeID& nid,
                       const DataValidatedCallback& onValidated,
                       const DataValidationErrorCallback& onValidationFailed,
                       const TimeoutCallback& onTimeout,
-                      int nRetries)
+                      int nRetries,
+                      std::optional<FetchPriority> priority,
+                      bool isSpeculative)
 {
   Name interestName = getDataName(nid, seqNo);
   Interest interest(interestName);
   interest.setCanBePrefix(true);
+  // Until the RTT to the producer is known
   interest.setInterestLifetime(2_s);
 
+  // The newest publication of a node goes before its history; data
+  // beyond it is not known to exist, and does not hold back either
+  if (!priority) {
+    SeqNo latest = m_core.getSeqNo(nid);
+    if (seqNo == latest)
+      priority = FetchPriority::High;
+    else
+      priority = seqNo < latest ? FetchPriority::Normal : FetchPriority::Low;
+  }
+
   m_fetcher.expressInterest(interest,
                             std::bind(&SVSyncBase::onDataValidated, this, _2, onValidated),
                             std::bind(onTimeout, _1), // Nack
                             onTimeout,
                             nRetries,
-                            onValidationFailed);
+                            onValidationFailed,
+                            nid,
+                            *priority,
+                            isSpeculative);
 }
 
 void
@@ -41,6 +41,8 @@ namespace ndn::svs {
  * @param updateCallback The callback function to handle state updates
  * @param securityOptions Signing and validation options for interests and data
  * @param dataStore Interface to store data packets
+ * @param coreOptions Timer options of the sync core
+ * @param fetcherOptions Window and timeout options of the data fetcher
  */
 class SVSyncBase : noncopyable
 {
@@ -51,7 +53,9 @@ public:
              ndn::Face& face,
              const UpdateCallback& updateCallback,
              const SecurityOptions& securityOptions = SecurityOptions::DEFAULT,
-             std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE);
+             std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE,
+             const SyncCoreOptions& coreOptions = {},
+             const FetcherOptions& fetcherOptions = {});
 
   virtual ~SVSyncBase() = default;
 
@@ -86,13 +90,16 @@ public:
    * @param content Block that will be set as the content of the data packet.
    * @param freshness FreshnessPeriod of the data packet.
    * @param nid NodeID to publish the data under
+   * @param contentType ContentType of the data packet
+   * @param urgent Send the sync interest immediately instead of coalescing it
    *
    * @returns Sequence number of the published data packet
    */
   SeqNo publishData(const Block& content,
                     const ndn::time::milliseconds& freshness,
                     const NodeID& nid = EMPTY_NODE_ID,
-                    uint32_t contentType = ndn::tlv::Content);
+                    uint32_t contentType = ndn::tlv::Content,
+                    bool urgent = false);
 
   /**
    * Insert segment into the store without changing the sequence number.
@@ -138,13 +145,20 @@ public:
    * validation.
    * @param onTimeout The callback when data is not retrieved.
    * @param nRetries The number of retries.
+   * @param priority The priority class of the fetch. By default, the
+   * newest known publication of the node is fetched with high priority,
+   * and sequence numbers past it with low priority.
+   * @param isSpeculative Whether the data may not be published yet, e.g.
+   * when prefetching. Its timeout is not taken for a loss by the fetcher.
    */
   void fetchData(const NodeID& nid,
                  const SeqNo& seq,
                  const DataValidatedCallback& onValidated,
                  const DataValidationErrorCallback& onValidationFailed,
                  const TimeoutCallback& onTimeout,
-                 int nRetries = 0);
+                 int nRetries = 0,
+                 std::optional<FetchPriority> priority = std::nullopt,
+                 bool isSpeculative = false);
 
   /** @brief Get the underlying data store */
   DataStore& getDataStore()
@@ -158,6 +172,18 @@ public:
     return m_core;
   }
 
+  /** @brief Get the fetcher of data, e.g. to monitor its window */
+  const Fetcher& getFetcher() const
+  {
+    return m_fetcher;
+  }
+
+  /** @brief Get the fetcher of data, e.g. to share it with other fetches of the group */
+  Fetcher& getFetcher()
+  {
+    return m_fetcher;
+  }
+
 protected:
   /**
    * @brief Return data name for a given packet
@@ -37,14 +37,18 @@ public:
                ndn::Face& face,
                const UpdateCallback& updateCallback,
                const SecurityOptions& securityOptions = SecurityOptions::DEFAULT,
-               std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE)
+               std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE,
+               const SyncCoreOptions& coreOptions = {},
+               const FetcherOptions& fetcherOptions = {})
     : SVSyncBase(Name(grpPrefix).append("s"),
                  Name(grpPrefix).append("d"),
                  id,
                  face,
                  updateCallback,
                  securityOptions,
-                 std::move(dataStore))
+                 std::move(dataStore),
+                 coreOptions,
+                 fetcherOptions)
   {
   }
 
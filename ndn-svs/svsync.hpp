@@ -36,14 +36,18 @@ public:
          ndn::Face& face,
          const UpdateCallback& updateCallback,
          const SecurityOptions& securityOptions = SecurityOptions::DEFAULT,
-         std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE)
+         std::shared_ptr<DataStore> dataStore = DEFAULT_DATASTORE,
+         const SyncCoreOptions& coreOptions = {},
+         const FetcherOptions& fetcherOptions = {})
     : SVSyncBase(syncPrefix,
                  Name(nodePrefix).append(syncPrefix),
                  nodePrefix,
                  face,
                  updateCallback,
                  securityOptions,
-                 std::move(dataStore))
+                 std::move(dataStore),
+                 coreOptions,
+                 fetcherOptions)
   {
   }
 
@@ -0,0 +1,106 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#include "sync-group-manager.hpp"
+
+namespace ndn::svs {
+
+SyncGroupManager::SyncGroupManager(ndn::Face& face, const Name& prefix)
+  : m_face(face)
+  , m_prefix(prefix)
+  , m_scheduler(face.getIoContext())
+{
+  m_registeredPrefix =
+    m_face.setInterestFilter(m_prefix,
+                             std::bind(&SyncGroupManager::onSyncInterest, this, _2),
+                             std::bind(&SyncGroupManager::onRegistered, this),
+                             [](auto&&...) { NDN_THROW(Error("Failed to register sync prefix")); });
+}
+
+SVSyncCore&
+SyncGroupManager::addGroup(const Name& syncPrefix,
+                           const UpdateCallback& onUpdate,
+                           const SecurityOptions& securityOptions,
+                           const NodeID& nid,
+                           const SyncCoreOptions& options)
+{
+  if (!m_prefix.isPrefixOf(syncPrefix))
+    NDN_THROW(Error("Sync prefix " + syncPrefix.toUri() + " is not under " + m_prefix.toUri()));
+  if (m_groups.count(syncPrefix) > 0)
+    NDN_THROW(Error("Sync group " + syncPrefix.toUri() + " already exists"));
+
+  // The hosted constructor is only accessible to the manager
+  std::unique_ptr<SVSyncCore> core(
+    new SVSyncCore(m_face, &m_scheduler, syncPrefix, onUpdate, securityOptions, nid, options));
+  auto& group = *core;
+  m_groups.emplace(syncPrefix, std::move(core));
+
+  // Groups added later start right away
+  if (m_isRegistered)
+    group.sendInitialInterest();
+
+  return group;
+}
+
+bool
+SyncGroupManager::removeGroup(const Name& syncPrefix)
+{
+  return m_groups.erase(syncPrefix) > 0;
+}
+
+SVSyncCore*
+SyncGroupManager::findGroup(const Name& syncPrefix) const
+{
+  auto it = m_groups.find(syncPrefix);
+  return it == m_groups.end() ? nullptr : it->second.get();
+}
+
+void
+SyncGroupManager::onSyncInterest(const Interest& interest)
+{
+  // Sync interests are named /<sync-prefix>/<version>/<params-digest>,
+  // followed by the signature components of v0.2 signed interests, so the
+  // group is the longest registered prefix that is followed by a version
+  const auto& name = interest.getName();
+  if (name.size() < m_prefix.size() + 2)
+    return;
+
+  for (size_t end = name.size() - 1; end > m_prefix.size(); --end) {
+    // The prefix of the group ends before the version
+    size_t size = end - 1;
+    if (!name.get(size).isVersion())
+      continue;
+
+    auto it = m_groups.find(name.getPrefix(size));
+    if (it != m_groups.end()) {
+      it->second->onSyncInterest(interest);
+      return;
+    }
+  }
+}
+
+void
+SyncGroupManager::onRegistered()
+{
+  if (m_isRegistered)
+    return;
+
+  m_isRegistered = true;
+  for (auto& [prefix, group] : m_groups)
+    group->sendInitialInterest();
+}
+
+} // namespace ndn::svs
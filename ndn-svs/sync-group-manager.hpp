@@ -0,0 +1,112 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#ifndef NDN_SVS_SYNC_GROUP_MANAGER_HPP
+#define NDN_SVS_SYNC_GROUP_MANAGER_HPP
+
+#include "core.hpp"
+
+#include <unordered_map>
+
+namespace ndn::svs {
+
+/**
+ * @brief Host of many sync groups on one face
+ *
+ * All groups share one scheduler, and thus one timer of the face, and one
+ * registration of a common prefix; incoming sync interests are dispatched
+ * to the group by their sync prefix. Groups with their own SVSyncCore each
+ * register their sync prefix and run their own scheduler.
+ *
+ * The manager and its groups must be used from the thread of the face.
+ */
+class SyncGroupManager : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @param face face shared by all groups
+   * @param prefix common prefix of the sync prefixes of all groups
+   */
+  SyncGroupManager(ndn::Face& face, const Name& prefix);
+
+  /**
+   * @brief Create a sync group hosted by the manager
+   *
+   * The parameters are the same as for the SVSyncCore constructor. The
+   * group lives until removed or until the manager is destroyed.
+   *
+   * @throws Error if @p syncPrefix is not under the common prefix or
+   *         a group with the same prefix exists
+   */
+  SVSyncCore& addGroup(const Name& syncPrefix,
+                       const UpdateCallback& onUpdate,
+                       const SecurityOptions& securityOptions = SecurityOptions::DEFAULT,
+                       const NodeID& nid = SVSyncCore::EMPTY_NODE_ID,
+                       const SyncCoreOptions& options = {});
+
+  /**
+   * @brief Destroy a sync group
+   *
+   * Must not be called from the onUpdate callback of the same group, which
+   * runs inside the group being destroyed; post the removal to the face
+   * instead.
+   *
+   * @returns whether the group existed
+   */
+  bool removeGroup(const Name& syncPrefix);
+
+  /// @brief Get a group by its sync prefix, or nullptr if not found
+  SVSyncCore* findGroup(const Name& syncPrefix) const;
+
+  /// @brief Number of hosted groups
+  size_t size() const
+  {
+    return m_groups.size();
+  }
+
+  /// @brief Scheduler shared by all groups
+  ndn::Scheduler& getScheduler()
+  {
+    return m_scheduler;
+  }
+
+  NDN_SVS_PUBLIC_WITH_TESTS_ELSE_PRIVATE : void onSyncInterest(const Interest& interest);
+
+private:
+  void onRegistered();
+
+private:
+  ndn::Face& m_face;
+  const Name m_prefix;
+
+  // Declared before the groups, whose events are cancelled on destruction
+  ndn::Scheduler m_scheduler;
+
+  std::unordered_map<Name, std::unique_ptr<SVSyncCore>> m_groups;
+
+  ndn::ScopedRegisteredPrefixHandle m_registeredPrefix;
+  bool m_isRegistered = false;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_SYNC_GROUP_MANAGER_HPP
@@ -29,6 +29,12 @@ enum : uint32_t
   MappingData = 205,
   MappingEntry = 206,
   LzmaBlock = 211,
+  // ndn-svs extensions
+  PartialStateVector = 220,
+  CompactStateVector = 221,
+  ZstdBlock = 222,
+  StateVectorFragment = 223,
+  FragmentIndex = 224,
 };
 
 } // namespace ndn::svs::tlv
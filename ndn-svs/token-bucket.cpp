@@ -0,0 +1,83 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "token-bucket.hpp"
+
+#include <algorithm>
+
+namespace ndn::svs {
+
+TokenBucket::TokenBucket(double rate, double burst)
+{
+  setRate(rate, burst);
+}
+
+void
+TokenBucket::setRate(double rate, double burst)
+{
+  m_rate = rate;
+  m_burst = std::max(burst, 1.0);
+  m_tokens = m_burst;
+  m_lastRefill = time::steady_clock::now();
+}
+
+void
+TokenBucket::refill(time::steady_clock::time_point now)
+{
+  if (now <= m_lastRefill)
+    return;
+
+  time::duration<double> elapsed = now - m_lastRefill;
+  m_tokens = std::min(m_burst, m_tokens + elapsed.count() * m_rate);
+  m_lastRefill = now;
+}
+
+time::nanoseconds
+TokenBucket::getWaitTime(time::steady_clock::time_point now)
+{
+  if (!isLimited())
+    return time::nanoseconds::zero();
+
+  refill(now);
+
+  if (m_tokens >= 1)
+    return time::nanoseconds::zero();
+
+  time::duration<double> wait((1 - m_tokens) / m_rate);
+  return time::duration_cast<time::nanoseconds>(wait) + time::nanoseconds(1);
+}
+
+time::nanoseconds
+TokenBucket::take(time::steady_clock::time_point now)
+{
+  auto wait = getWaitTime(now);
+  if (wait == time::nanoseconds::zero() && isLimited())
+    m_tokens -= 1;
+  return wait;
+}
+
+void
+TokenBucket::charge(double n, time::steady_clock::time_point now)
+{
+  if (!isLimited())
+    return;
+
+  refill(now);
+  m_tokens -= n;
+}
+
+} // namespace ndn::svs
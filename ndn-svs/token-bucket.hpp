@@ -0,0 +1,81 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_TOKEN_BUCKET_HPP
+#define NDN_SVS_TOKEN_BUCKET_HPP
+
+#include "common.hpp"
+
+namespace ndn::svs {
+
+/**
+ * @brief Token bucket rate limiter
+ *
+ * Tokens are added continuously at the configured rate, up to the burst
+ * size. The bucket is not synchronized; callers must serialize access.
+ */
+class TokenBucket
+{
+public:
+  /**
+   * @param rate tokens added per second, or 0 for no limit
+   * @param burst maximum number of tokens in the bucket
+   */
+  explicit TokenBucket(double rate = 0, double burst = 1);
+
+  /// @brief Change the rate and burst size; the bucket is refilled
+  void setRate(double rate, double burst);
+
+  /// @brief Whether the bucket limits the rate at all
+  bool isLimited() const noexcept
+  {
+    return m_rate > 0;
+  }
+
+  /**
+   * @brief Time until a token is available, without taking it
+   * @returns zero if a token is available now
+   */
+  time::nanoseconds getWaitTime(time::steady_clock::time_point now = time::steady_clock::now());
+
+  /**
+   * @brief Take a token if one is available
+   * @returns zero if a token was taken, otherwise the time until one is available
+   */
+  time::nanoseconds take(time::steady_clock::time_point now = time::steady_clock::now());
+
+  /**
+   * @brief Take @p n tokens whether or not they are available
+   *
+   * The bucket may go into debt, which delays later take() calls until
+   * it is repaid at the configured rate.
+   */
+  void charge(double n, time::steady_clock::time_point now = time::steady_clock::now());
+
+private:
+  void refill(time::steady_clock::time_point now);
+
+private:
+  double m_rate;
+  double m_burst;
+  double m_tokens;
+  time::steady_clock::time_point m_lastRefill;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_TOKEN_BUCKET_HPP
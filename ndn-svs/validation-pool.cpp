@@ -0,0 +1,85 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "validation-pool.hpp"
+
+#include <algorithm>
+
+namespace ndn::svs {
+
+ValidationPool::ValidationPool(size_t nThreads, size_t maxQueueSize)
+  : m_maxQueueSize(std::max<size_t>(maxQueueSize, 1))
+{
+  for (size_t i = 0; i < std::max<size_t>(nThreads, 1); i++)
+    m_threads.emplace_back(&ValidationPool::run, this);
+}
+
+ValidationPool::~ValidationPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+    m_queue.clear();
+  }
+  m_cv.notify_all();
+
+  for (auto& thread : m_threads)
+    thread.join();
+}
+
+void
+ValidationPool::post(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // The pool is behind; the oldest interest is the most stale
+    if (m_queue.size() >= m_maxQueueSize) {
+      m_queue.pop_front();
+      m_nDropped++;
+    }
+
+    m_queue.push_back(std::move(task));
+  }
+  m_cv.notify_one();
+}
+
+void
+ValidationPool::run()
+{
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+      if (m_stop)
+        return;
+
+      task = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    // An exception must not end the thread; the interest is dropped
+    try {
+      task();
+    } catch (const std::exception&) {
+      m_nFailed++;
+    }
+  }
+}
+
+} // namespace ndn::svs
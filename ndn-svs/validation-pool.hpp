@@ -0,0 +1,85 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_VALIDATION_POOL_HPP
+#define NDN_SVS_VALIDATION_POOL_HPP
+
+#include "common.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ndn::svs {
+
+/**
+ * @brief Thread pool to verify signatures of sync interests
+ *
+ * Tasks are run in the order they were posted. The queue is bounded;
+ * when it is full, the oldest task is dropped, since the newest sync
+ * interests carry the most recent state.
+ */
+class ValidationPool : noncopyable
+{
+public:
+  using Task = std::function<void()>;
+
+  /**
+   * @param nThreads number of worker threads
+   * @param maxQueueSize maximum number of tasks waiting for a thread
+   */
+  ValidationPool(size_t nThreads, size_t maxQueueSize);
+
+  /// @brief Discard all waiting tasks and join the worker threads
+  ~ValidationPool();
+
+  /// @brief Queue a task, dropping the oldest waiting task if the queue is full
+  void post(Task task);
+
+  /// @brief Number of tasks dropped because the queue was full
+  uint64_t getDropped() const
+  {
+    return m_nDropped;
+  }
+
+  /// @brief Number of tasks that ended with an exception
+  uint64_t getFailed() const
+  {
+    return m_nFailed;
+  }
+
+private:
+  void run();
+
+private:
+  const size_t m_maxQueueSize;
+
+  std::deque<Task> m_queue;
+  bool m_stop = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::atomic<uint64_t> m_nDropped = 0;
+  std::atomic<uint64_t> m_nFailed = 0;
+
+  std::vector<std::thread> m_threads;
+};
+
+} // namespace ndn::svs
+
+#endif // NDN_SVS_VALIDATION_POOL_HPP
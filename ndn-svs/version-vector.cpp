@@ -17,43 +17,171 @@
 #include "version-vector.hpp"
 #include "tlv.hpp"
 
+#include <atomic>
+#include <functional>
+
 namespace ndn::svs {
 
 VersionVector::VersionVector(const ndn::Block& block)
+  : VersionVector(StateVectorView(block))
+{
+}
+
+VersionVector::VersionVector(const StateVectorView& view)
 {
-  if (block.type() != tlv::StateVector)
-    NDN_THROW(ndn::tlv::Error("StateVector", block.type()));
+  m_chunks.reserve(view.size() / CHUNK_SIZE + 1);
+
+  for (const auto& entry : view) {
+    set(entry.getNodeId(), entry.seqNo, time::system_clock::time_point::min());
+  }
+}
+
+VersionVector::Chunk&
+VersionVector::mutableChunk(size_t i)
+{
+  auto& chunk = m_chunks[i];
+  if (chunk.use_count() > 1) {
+    chunk = std::make_shared<Chunk>(*chunk);
+  } else {
+    // Order the writes after the reads of copies that released the chunk
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *chunk;
+}
+
+SeqNo
+VersionVector::set(const NodeID& nid, SeqNo seqNo, time::system_clock::time_point lastUpdate)
+{
+  auto it = lowerBound(nid);
+  size_t chunkIndex = it.m_chunk - m_chunks.cbegin();
+
+  if (it != end() && it->first == nid) {
+    Entry& entry = mutableChunk(chunkIndex)[it.m_index];
+    if (entry.second != seqNo) {
+      m_digest -= StateVectorView::hashEntry(entry.nodeIdHash, entry.second);
+      m_digest += StateVectorView::hashEntry(entry.nodeIdHash, seqNo);
+      entry.second = seqNo;
+      entry.wire = ndn::Block();
+    }
+    entry.lastUpdate = lastUpdate;
+    return seqNo;
+  }
 
-  block.parse();
+  // Entries after the last one are appended to the last chunk
+  size_t index = it.m_index;
+  if (it == end()) {
+    if (m_chunks.empty())
+      m_chunks.push_back(std::make_shared<Chunk>());
+    chunkIndex = m_chunks.size() - 1;
+    index = m_chunks.back()->size();
+  }
+
+  const ndn::Block& nodeIdWire = nid.wireEncode();
+  uint64_t nodeIdHash = StateVectorView::hashNodeId(nodeIdWire.value_bytes());
+  Chunk& chunk = mutableChunk(chunkIndex);
+  chunk.insert(chunk.begin() + index,
+               Entry{ { nid, seqNo }, lastUpdate, ndn::Block(), nodeIdHash, nodeIdWire });
+  m_digest += StateVectorView::hashEntry(nodeIdHash, seqNo);
+  m_size++;
+
+  if (chunk.size() >= 2 * CHUNK_SIZE) {
+    auto half = std::make_shared<Chunk>(std::make_move_iterator(chunk.begin() + CHUNK_SIZE),
+                                        std::make_move_iterator(chunk.end()));
+    chunk.erase(chunk.begin() + CHUNK_SIZE, chunk.end());
+    m_chunks.insert(m_chunks.begin() + chunkIndex + 1, std::move(half));
+  }
 
-  for (auto it = block.elements_begin(); it < block.elements_end(); it++) {
-    if (it->type() != tlv::StateVectorEntry)
-      NDN_THROW(ndn::tlv::Error("StateVectorEntry", it->type()));
+  return seqNo;
+}
+
+bool
+VersionVector::erase(const NodeID& nid)
+{
+  auto it = find(nid);
+  if (it == end())
+    return false;
 
-    it->parse();
-    NodeID nodeId(it->elements().at(0));
-    SeqNo seqNo = ndn::encoding::readNonNegativeInteger(it->elements().at(1));
+  size_t chunkIndex = it.m_chunk - m_chunks.cbegin();
+  m_digest -= StateVectorView::hashEntry(it->nodeIdHash, it->second);
+  m_size--;
 
-    m_map[nodeId] = seqNo;
+  if ((*it.m_chunk)->size() == 1) {
+    m_chunks.erase(m_chunks.begin() + chunkIndex);
+  } else {
+    Chunk& chunk = mutableChunk(chunkIndex);
+    chunk.erase(chunk.begin() + it.m_index);
   }
+  return true;
 }
 
-ndn::Block
-VersionVector::encode() const
+SeqNo
+VersionVector::get(const StateVectorView::Entry& other) const
 {
-  ndn::encoding::EncodingBuffer enc;
-  size_t totalLength = 0;
+  auto it = partitionPoint([&other](const Entry& entry) {
+    return StateVectorView::lessNodeId(entry.nodeIdWire.value_bytes(), other.nodeIdValue);
+  });
+
+  if (it == end() || !StateVectorView::equalNodeId(it->nodeIdWire.value_bytes(), other.nodeIdValue))
+    return 0;
+  return it->second;
+}
+
+template<typename Encoder>
+static size_t
+prependEntry(Encoder& encoder, const ndn::Block& nodeIdWire, SeqNo seqNo)
+{
+  // SeqNo
+  size_t entryLength = ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::SeqNo, seqNo);
+
+  // NodeID (Name)
+  entryLength += ndn::encoding::prependBlock(encoder, nodeIdWire);
 
-  for (auto it = m_map.rbegin(); it != m_map.rend(); it++) {
-    // SeqNo
-    size_t entryLength = ndn::encoding::prependNonNegativeIntegerBlock(enc, tlv::SeqNo, it->second);
+  size_t totalLength = entryLength;
+  totalLength += encoder.prependVarNumber(entryLength);
+  totalLength += encoder.prependVarNumber(tlv::StateVectorEntry);
+  return totalLength;
+}
+
+static ndn::Block
+encodeEntry(const ndn::Block& nodeIdWire, SeqNo seqNo)
+{
+  // Size the buffer exactly, since cached entries are kept around
+  ndn::encoding::EncodingEstimator estimator;
+  size_t length = prependEntry(estimator, nodeIdWire, seqNo);
 
-    // NodeID (Name)
-    entryLength += ndn::encoding::prependBlock(enc, it->first.wireEncode());
+  ndn::encoding::EncodingBuffer enc(length, 0);
+  prependEntry(enc, nodeIdWire, seqNo);
+  return enc.block();
+}
 
-    totalLength += enc.prependVarNumber(entryLength);
-    totalLength += enc.prependVarNumber(tlv::StateVectorEntry);
-    totalLength += entryLength;
+/**
+ * @brief Encode a StateVector from entries in encoding order
+ *
+ * Cached entry encodings are copied; other entries are encoded in place
+ * without touching the cache.
+ */
+template<typename Iterator>
+static ndn::Block
+encodeEntries(Iterator begin, Iterator end)
+{
+  ndn::encoding::EncodingEstimator estimator;
+  size_t totalLength = 0;
+  for (auto it = begin; it != end; ++it) {
+    const VersionVector::Entry& entry = *it;
+    totalLength += entry.wire.isValid() ? entry.wire.size()
+                                        : prependEntry(estimator, entry.nodeIdWire, entry.second);
+  }
+
+  ndn::encoding::EncodingBuffer enc(totalLength + ndn::tlv::sizeOfVarNumber(totalLength) +
+                                      ndn::tlv::sizeOfVarNumber(tlv::StateVector),
+                                    0);
+
+  for (auto it = end; it != begin;) {
+    const VersionVector::Entry& entry = *--it;
+    if (entry.wire.isValid())
+      ndn::encoding::prependBlock(enc, entry.wire);
+    else
+      prependEntry(enc, entry.nodeIdWire, entry.second);
   }
 
   enc.prependVarNumber(totalLength);
@@ -61,11 +189,51 @@ VersionVector::encode() const
   return enc.block();
 }
 
+ndn::Block
+VersionVector::encode() const
+{
+  return encodeEntries(begin(), end());
+}
+
+void
+VersionVector::cacheEncoding()
+{
+  auto isOutdated = [](const Entry& entry) { return !entry.wire.isValid(); };
+
+  // Chunks shared with published copies are up to date, and stay shared
+  for (size_t i = 0; i < m_chunks.size(); i++) {
+    if (std::none_of(m_chunks[i]->begin(), m_chunks[i]->end(), isOutdated))
+      continue;
+
+    for (auto& entry : mutableChunk(i)) {
+      if (isOutdated(entry))
+        entry.wire = encodeEntry(entry.nodeIdWire, entry.second);
+    }
+  }
+}
+
+ndn::Block
+VersionVector::encodeRecent(size_t maxEntries) const
+{
+  if (maxEntries >= size())
+    return encode();
+
+  std::vector<std::reference_wrapper<const Entry>> recent(begin(), end());
+  std::nth_element(recent.begin(), recent.begin() + maxEntries, recent.end(),
+                   [](const Entry& a, const Entry& b) { return a.lastUpdate > b.lastUpdate; });
+  recent.erase(recent.begin() + maxEntries, recent.end());
+
+  // Restore encoding order
+  std::sort(recent.begin(), recent.end(), [](const Entry& a, const Entry& b) { return a.first < b.first; });
+
+  return encodeEntries(recent.begin(), recent.end());
+}
+
 std::string
 VersionVector::toStr() const
 {
   std::ostringstream stream;
-  for (const auto& elem : m_map) {
+  for (const auto& elem : *this) {
     stream << elem.first << ":" << elem.second << " ";
   }
   return stream.str();
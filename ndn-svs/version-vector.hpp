@@ -18,11 +18,20 @@
 #define NDN_SVS_VERSION_VECTOR_HPP
 
 #include "common.hpp"
+#include "state-vector-view.hpp"
 
-#include <map>
+#include <algorithm>
+#include <iterator>
 
 namespace ndn::svs {
 
+/**
+ * @brief State vector of a sync group
+ *
+ * Entries are stored sorted in fixed-size chunks shared between copies,
+ * so copying a vector only copies the chunk pointers, and an update
+ * clones no more than the one chunk it modifies.
+ */
 class VersionVector
 {
 public:
@@ -32,56 +41,258 @@ public:
     using std::runtime_error::runtime_error;
   };
 
-  using const_iterator = std::map<NodeID, SeqNo>::const_iterator;
+  /**
+   * @brief A single record of the version vector
+   *
+   * The sequence number and last update time of a node are kept together
+   * in one contiguous record. Entries are derived from std::pair so that
+   * iteration yields (NodeID, SeqNo) as with a std::map.
+   */
+  struct Entry : std::pair<NodeID, SeqNo>
+  {
+    /// @brief Local time of the last update of this entry
+    time::system_clock::time_point lastUpdate;
+    /// @brief Cached StateVectorEntry encoding, invalid if outdated
+    ndn::Block wire;
+    /// @brief Hash of the encoded NodeID, see StateVectorView::hashNodeId
+    uint64_t nodeIdHash = 0;
+    /// @brief Encoded NodeID, compared with encoded entries without touching the Name
+    ndn::Block nodeIdWire;
+  };
+
+private:
+  using Chunk = std::vector<Entry>;
+  using ChunkList = std::vector<std::shared_ptr<Chunk>>;
+
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Entry;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Entry*;
+    using reference = const Entry&;
+
+    const_iterator() = default;
+
+    reference operator*() const
+    {
+      return (**m_chunk)[m_index];
+    }
+
+    pointer operator->() const
+    {
+      return &**this;
+    }
+
+    const_iterator& operator++()
+    {
+      if (++m_index == (*m_chunk)->size()) {
+        ++m_chunk;
+        m_index = 0;
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      auto it = *this;
+      ++*this;
+      return it;
+    }
+
+    const_iterator& operator--()
+    {
+      if (m_index == 0) {
+        --m_chunk;
+        m_index = (*m_chunk)->size();
+      }
+      --m_index;
+      return *this;
+    }
+
+    const_iterator operator--(int)
+    {
+      auto it = *this;
+      --*this;
+      return it;
+    }
+
+    friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept
+    {
+      return a.m_chunk == b.m_chunk && a.m_index == b.m_index;
+    }
+
+    friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept
+    {
+      return !(a == b);
+    }
+
+  private:
+    const_iterator(ChunkList::const_iterator chunk, size_t index)
+      : m_chunk(chunk)
+      , m_index(index)
+    {
+    }
+
+  private:
+    ChunkList::const_iterator m_chunk;
+    size_t m_index = 0;
+
+    friend class VersionVector;
+  };
 
   VersionVector() = default;
 
   /** Decode a version vector from ndn::Block */
   explicit VersionVector(const ndn::Block& encoded);
 
-  /** Encode the version vector to a string */
+  /** Decode all entries of a StateVector view */
+  explicit VersionVector(const StateVectorView& view);
+
+  /**
+   * @brief Encode the version vector to a block
+   *
+   * Cached entry encodings from the last cacheEncoding() are copied, so
+   * only entries updated since then are encoded. This does not modify the
+   * vector and is safe to call concurrently on a shared instance.
+   */
   ndn::Block encode() const;
 
+  /**
+   * @brief Encode all outdated entries and cache their encodings
+   *
+   * Called on the writer side before publishing a vector to readers.
+   * Only chunks with updated entries are touched.
+   */
+  void cacheEncoding();
+
+  /**
+   * @brief Encode only the @p maxEntries most recently updated entries
+   *
+   * The entries are encoded in the same order as encode(). If the vector
+   * has no more than @p maxEntries entries, this is the same as encode().
+   */
+  ndn::Block encodeRecent(size_t maxEntries) const;
+
   /** Get a human-readable representation */
   std::string toStr() const;
 
   SeqNo set(const NodeID& nid, SeqNo seqNo)
   {
-    m_map[nid] = seqNo;
-    m_lastUpdate[nid] = time::system_clock::now();
-    return seqNo;
+    return set(nid, seqNo, time::system_clock::now());
   }
 
+  /**
+   * @brief Remove the entry of @p nid
+   * @returns whether the entry was present
+   */
+  bool erase(const NodeID& nid);
+
   SeqNo get(const NodeID& nid) const
   {
-    auto elem = m_map.find(nid);
-    return elem == m_map.end() ? 0 : elem->second;
+    auto elem = find(nid);
+    return elem == end() ? 0 : elem->second;
   }
 
+  /**
+   * @brief Get the sequence number of an entry of an encoded StateVector
+   *
+   * The lookup compares the encoded NodeID directly and does not decode it.
+   */
+  SeqNo get(const StateVectorView::Entry& entry) const;
+
   time::system_clock::time_point getLastUpdate(const NodeID& nid) const
   {
-    auto elem = m_lastUpdate.find(nid);
-    return elem == m_lastUpdate.end() ? time::system_clock::time_point::min() : elem->second;
+    auto elem = find(nid);
+    return elem == end() ? time::system_clock::time_point::min() : elem->lastUpdate;
   }
 
   const_iterator begin() const noexcept
   {
-    return m_map.begin();
+    return { m_chunks.begin(), 0 };
   }
 
   const_iterator end() const noexcept
   {
-    return m_map.end();
+    return { m_chunks.end(), 0 };
   }
 
   bool has(const NodeID& nid) const
   {
-    return m_map.find(nid) != end();
+    return find(nid) != end();
+  }
+
+  size_t size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * @brief Get the order-independent digest of all entries
+   *
+   * The digest is maintained on every update, and equals the digest of a
+   * StateVectorView of an identical vector.
+   */
+  uint64_t getDigest() const noexcept
+  {
+    return m_digest;
   }
 
 private:
-  std::map<NodeID, SeqNo> m_map;
-  std::map<NodeID, time::system_clock::time_point> m_lastUpdate;
+  SeqNo set(const NodeID& nid, SeqNo seqNo, time::system_clock::time_point lastUpdate);
+
+  /**
+   * @brief Find the first entry for which @p isBefore is false
+   *
+   * Entries are appended in order when decoding and in steady state,
+   * so the last entry is checked before falling back to binary search.
+   */
+  template<typename Predicate>
+  const_iterator partitionPoint(Predicate isBefore) const
+  {
+    if (m_chunks.empty() || isBefore(m_chunks.back()->back()))
+      return end();
+
+    auto chunk = std::partition_point(m_chunks.begin(), m_chunks.end(),
+                                      [&](const auto& c) { return isBefore(c->back()); });
+    auto entry = std::partition_point((*chunk)->begin(), (*chunk)->end(), isBefore);
+    return { chunk, static_cast<size_t>(entry - (*chunk)->begin()) };
+  }
+
+  const_iterator lowerBound(const NodeID& nid) const
+  {
+    return partitionPoint([&nid](const Entry& entry) { return entry.first < nid; });
+  }
+
+  const_iterator find(const NodeID& nid) const
+  {
+    auto it = lowerBound(nid);
+    return it != end() && it->first == nid ? it : end();
+  }
+
+  /**
+   * @brief Get chunk @p i for modification
+   *
+   * A chunk shared with a copy of this vector is cloned first.
+   */
+  Chunk& mutableChunk(size_t i);
+
+private:
+  // Entries per chunk after a split; chunks are split at twice this size
+  static constexpr size_t CHUNK_SIZE = 64;
+
+  // Non-empty chunks, sorted by NodeID, which is also the encoding order
+  ChunkList m_chunks;
+  size_t m_size = 0;
+  // Sum of StateVectorView::hashEntry over all entries
+  uint64_t m_digest = 0;
 };
 
 } // namespace ndn::svs
@@ -0,0 +1,124 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#define BOOST_TEST_MODULE ndn-svs buffer pool benchmark
+
+#include "buffer-pool.hpp"
+#include "core.hpp"
+#include "tlv.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations, to verify that steady-state encoding does not
+// allocate; replacing operator new is only done in this standalone module
+static std::atomic<size_t> g_nAllocations = 0;
+
+void*
+operator new(std::size_t size)
+{
+  g_nAllocations++;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static constexpr size_t N_ROUNDS = 100000;
+
+/**
+ * @brief Run @p f N_ROUNDS times, print the time per round, and return the heap allocations
+ */
+template<typename F>
+static size_t
+countAllocations(const std::string& what, size_t groupSize, const F& f)
+{
+  size_t before = g_nAllocations;
+  auto elapsed = timedExecute([&] {
+    for (size_t i = 0; i < N_ROUNDS; i++)
+      f();
+  });
+  size_t nAllocations = g_nAllocations - before;
+
+  printResult(what, groupSize, N_ROUNDS, elapsed);
+  return nAllocations;
+}
+
+BOOST_AUTO_TEST_SUITE(BufferPoolBench)
+
+BOOST_AUTO_TEST_CASE(EncodeWithoutAllocation)
+{
+  BufferPool pool;
+  auto element = ndn::encoding::makeStringBlock(ndn::tlv::Content, "element");
+
+  // Warm up the pool
+  pool.encode(ndn::tlv::ApplicationParameters, { &element });
+
+  BOOST_CHECK_EQUAL(countAllocations("pool encode", 1,
+                                     [&] { pool.encode(ndn::tlv::ApplicationParameters, { &element }); }),
+                    0);
+}
+
+BOOST_AUTO_TEST_CASE(SyncParametersWithoutAllocation)
+{
+  Face face;
+  SVSyncCore core(face, "/ndn/test", [](auto&&...) {});
+
+  VersionVector vv;
+  for (int i = 0; i < 100; i++)
+    vv.set(Name("/node").appendNumber(i), i + 1);
+  core.setState(vv);
+
+  // Warm up the pool and encode the vector once; copy the result
+  // to release the pooled buffer
+  auto state = core.getState();
+  auto vvWire = state->encode();
+  auto params = core.encodeSyncParameters(vvWire, Block(), false);
+  Block expected(span<const uint8_t>(params.data(), params.size()));
+  params = Block();
+
+  BOOST_CHECK_EQUAL(countAllocations("sync parameters", vv.size(),
+                                     [&] { core.encodeSyncParameters(vvWire, Block(), false); }),
+                    0);
+
+  params = core.encodeSyncParameters(vvWire, Block(), false);
+  BOOST_CHECK(params == expected);
+  params.parse();
+  BOOST_CHECK(params.get(svs::tlv::StateVector) == vvWire);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
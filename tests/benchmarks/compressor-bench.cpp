@@ -0,0 +1,119 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#define BOOST_TEST_MODULE ndn-svs compressor benchmark
+
+#include "compressor.hpp"
+#include "version-vector.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <random>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+// Sync interests carry full vectors of these group sizes
+static const std::vector<size_t> GROUP_SIZES = { 10, 100, 1000 };
+static constexpr size_t N_ROUNDS = 1000;
+
+/**
+ * @brief Generate a state vector with random sequence numbers
+ */
+static Block
+makeStateVector(size_t n, std::mt19937& rng)
+{
+  std::uniform_int_distribution<SeqNo> dist(1, 100000);
+  VersionVector vv;
+  for (size_t i = 0; i < n; i++)
+    vv.set(Name("/org/site").appendNumber(i / 100).append("host").appendNumber(i), dist(rng));
+  return vv.encode();
+}
+
+/**
+ * @brief Print compression ratio and time per compression and decompression
+ */
+static void
+runCompressor(const std::string& what, Compressor& compressor)
+{
+  std::mt19937 rng(0);
+
+  for (size_t n : GROUP_SIZES) {
+    auto wire = makeStateVector(n, rng);
+
+    Block compressed;
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        compressed = compressor.compress({ wire.data(), wire.size() });
+    });
+    printResult(what + " compress", n, N_ROUNDS, d);
+
+    ndn::ConstBufferPtr decompressed;
+    d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        decompressed = compressor.decompress(compressed.value_bytes());
+    });
+    printResult(what + " decompress", n, N_ROUNDS, d);
+    BOOST_CHECK_EQUAL(decompressed->size(), wire.size());
+
+    std::cout << what << " ratio (n=" << n << "): " << compressed.size() << "/" << wire.size() << " = "
+              << static_cast<double>(compressed.size()) / wire.size() << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(CompressorBench)
+
+BOOST_AUTO_TEST_CASE(Uncompressed)
+{
+  std::mt19937 rng(0);
+  for (size_t n : GROUP_SIZES)
+    std::cout << "uncompressed size (n=" << n << "): " << makeStateVector(n, rng).size() << std::endl;
+}
+
+#ifdef NDN_SVS_COMPRESSION
+BOOST_AUTO_TEST_CASE(Lzma)
+{
+  LzmaCompressor lzma;
+  runCompressor("lzma", lzma);
+}
+#endif
+
+#ifdef NDN_SVS_HAVE_ZSTD
+BOOST_AUTO_TEST_CASE(Zstd)
+{
+  ZstdCompressor zstd;
+  runCompressor("zstd", zstd);
+}
+
+BOOST_AUTO_TEST_CASE(ZstdDictionary)
+{
+  // Train on vectors from the same distribution as the benchmark
+  std::mt19937 rng(1);
+  std::vector<Block> samples;
+  for (size_t i = 0; i < 100; i++)
+    samples.push_back(makeStateVector(GROUP_SIZES[i % GROUP_SIZES.size()], rng));
+
+  ZstdCompressor zstd(1, ZstdCompressor::trainDictionary(samples));
+  runCompressor("zstd+dict", zstd);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
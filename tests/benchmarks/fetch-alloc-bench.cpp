@@ -0,0 +1,173 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#define BOOST_TEST_MODULE ndn-svs fetch allocation benchmark
+
+#include "fetcher.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations
+static std::atomic<int64_t> g_nAllocations = 0;
+
+void*
+operator new(std::size_t size)
+{
+  void* ptr = std::malloc(size);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  g_nAllocations++;
+  return ptr;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static constexpr size_t N_FETCHES = 100000;
+
+/**
+ * @brief Fetch objects through @p express, answering each interest at once
+ *
+ * The Data packets are signed beforehand, so the count covers the fetch
+ * path from the interest to the Data callback.
+ *
+ * @returns heap allocations per fetch
+ */
+template<typename Express>
+static double
+runFetches(const std::string& what, boost::asio::io_context& io, util::DummyClientFace& face,
+           const Express& express)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  std::vector<Data> replies;
+  replies.reserve(N_FETCHES);
+  for (size_t i = 0; i < N_FETCHES; i++) {
+    replies.emplace_back(Name("/producer/data").appendNumber(i));
+    keyChain.sign(replies.back(), security::signingWithSha256());
+    replies.back().wireEncode();
+  }
+
+  size_t nDone = 0;
+  auto onData = [&nDone](const Interest&, const Data&) { nDone++; };
+
+  int64_t before = g_nAllocations;
+  auto elapsed = timedExecute([&] {
+    for (size_t i = 0; i < N_FETCHES; i++) {
+      Interest interest(replies[i].getName());
+      express(interest, onData);
+      io.poll();
+      face.receive(replies[i]);
+      io.poll();
+    }
+  });
+  double nAllocations = static_cast<double>(g_nAllocations - before) / N_FETCHES;
+
+  BOOST_CHECK_EQUAL(nDone, N_FETCHES);
+  printResult(what, N_FETCHES, N_FETCHES, elapsed);
+  std::cout << what << " (n=" << N_FETCHES << "): " << nAllocations << " allocations/fetch" << std::endl;
+  return nAllocations;
+}
+
+// Baseline of the face itself, without Fetcher
+static double
+fetchWithFace()
+{
+  boost::asio::io_context io;
+  util::DummyClientFace face(io, { false, false });
+
+  return runFetches("face", io, face, [&](const Interest& interest, const DataCallback& onData) {
+    face.expressInterest(interest, onData, nullptr, nullptr);
+  });
+}
+
+static double
+fetchWithFetcher()
+{
+  boost::asio::io_context io;
+  util::DummyClientFace face(io, { false, false });
+  Fetcher fetcher(face, SecurityOptions::DEFAULT);
+  const Name producer("/producer");
+  auto ignore = [](auto&&...) {};
+
+  return runFetches("fetcher", io, face, [&](const Interest& interest, const DataCallback& onData) {
+    fetcher.expressInterest(interest, onData, ignore, ignore, 0, nullptr, producer);
+  });
+}
+
+// Data is passed through a validator that accepts it at once
+static double
+fetchWithValidator()
+{
+  boost::asio::io_context io;
+  util::DummyClientFace face(io, { false, false });
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.validator = std::make_shared<BaseValidator>();
+  Fetcher fetcher(face, secOpts);
+  const Name producer("/producer");
+  auto ignore = [](auto&&...) {};
+
+  return runFetches("fetcher+validator", io, face, [&](const Interest& interest, const DataCallback& onData) {
+    fetcher.expressInterest(interest, onData, ignore, ignore, 0, nullptr, producer);
+  });
+}
+
+BOOST_AUTO_TEST_SUITE(FetchAllocBench)
+
+BOOST_AUTO_TEST_CASE(WithFetcher)
+{
+  double baseline = fetchWithFace();
+  double nAllocations = fetchWithFetcher();
+
+  // Slots, queues and producer state are reused, so only the face allocates;
+  // the margin covers the one-time growth of the tables
+  BOOST_CHECK_LT(nAllocations - baseline, 0.01);
+}
+
+BOOST_AUTO_TEST_CASE(WithValidator)
+{
+  double baseline = fetchWithFace();
+  double nAllocations = fetchWithValidator();
+
+  // The interest is kept in its slot after validation, so it is reused as well
+  BOOST_CHECK_LT(nAllocations - baseline, 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,120 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#define BOOST_TEST_MODULE ndn-svs fetch priority benchmark
+
+#include "fetcher.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <algorithm>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+// Backlog of old publications queued when a node catches up
+static constexpr size_t N_BACKLOG = 2000;
+// A new publication arrives every PUBLISH_INTERVAL
+static constexpr size_t N_PUBLICATIONS = 100;
+static constexpr time::milliseconds PUBLISH_INTERVAL = 2_ms;
+// Round-trip time of the simulated link
+static constexpr time::milliseconds LINK_RTT = 1_ms;
+
+/**
+ * @brief Fetch new publications while the fetcher works through a backlog
+ *
+ * Reports the median and tail latency of the new publications only.
+ */
+static void
+runFetches(const std::string& what, FetchPriority newPriority)
+{
+  boost::asio::io_context io;
+  util::DummyClientFace face(io);
+  Scheduler scheduler(io);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Fetcher fetcher(face, SecurityOptions::DEFAULT);
+
+  face.onSendInterest.connect([&](const Interest& interest) {
+    scheduler.schedule(LINK_RTT, [&, name = interest.getName()] {
+      Data data(name);
+      keyChain.sign(data, security::signingWithSha256());
+      face.receive(data);
+    });
+  });
+
+  auto ignore = [](auto&&...) {};
+  size_t nDone = 0;
+  std::vector<time::nanoseconds> latencies;
+
+  auto fetch = [&](const Name& name, FetchPriority priority, bool measure) {
+    Interest interest(name);
+    interest.setInterestLifetime(2_s);
+
+    auto start = time::steady_clock::now();
+    auto onDone = [&, start, measure](auto&&...) {
+      if (measure)
+        latencies.push_back(time::steady_clock::now() - start);
+      nDone++;
+    };
+    fetcher.expressInterest(interest, onDone, ignore, onDone, 0, nullptr, "/producer", priority);
+  };
+
+  auto elapsed = timedExecute([&] {
+    for (size_t i = 0; i < N_BACKLOG; i++)
+      fetch(Name("/producer/old").appendNumber(i), FetchPriority::Normal, false);
+
+    for (size_t i = 0; i < N_PUBLICATIONS; i++) {
+      scheduler.schedule(PUBLISH_INTERVAL * (i + 1), [&, i] {
+        fetch(Name("/producer/new").appendNumber(i), newPriority, true);
+      });
+    }
+
+    while (nDone < N_BACKLOG + N_PUBLICATIONS)
+      io.run_one();
+  });
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](size_t p) {
+    auto latency = latencies[std::min(latencies.size() - 1, latencies.size() * p / 100)];
+    return time::duration_cast<time::microseconds>(latency).count();
+  };
+
+  printResult(what, N_BACKLOG, N_BACKLOG + N_PUBLICATIONS, elapsed);
+  std::cout << what << " (n=" << N_PUBLICATIONS << "): new publication latency p50 " << percentile(50)
+            << " us, p99 " << percentile(99) << " us" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(FetchPriorityBench)
+
+BOOST_AUTO_TEST_CASE(Fifo)
+{
+  runFetches("fifo", FetchPriority::Normal);
+}
+
+BOOST_AUTO_TEST_CASE(Priority)
+{
+  runFetches("priority", FetchPriority::High);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,120 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#define BOOST_TEST_MODULE ndn-svs fetch recovery benchmark
+
+#include "fetcher.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static constexpr size_t N_FETCHES = 200;
+// Every LOSS_INTERVAL-th interest is lost
+static constexpr size_t LOSS_INTERVAL = 10;
+// Round-trip time of the simulated link
+static constexpr time::milliseconds LINK_RTT = 1_ms;
+
+/**
+ * @brief Fetch objects from a producer over a lossy link
+ *
+ * Interests carry the fixed lifetime of the data fetches of SVSync, which
+ * the fetcher replaces with the estimated timeout once RTTs are measured.
+ */
+static void
+runFetches(const std::string& what, const FetcherOptions& options)
+{
+  boost::asio::io_context io;
+  util::DummyClientFace face(io);
+  Scheduler scheduler(io);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Fetcher fetcher(face, SecurityOptions::DEFAULT, options);
+
+  // The producer replies after one RTT, except to lost interests
+  size_t nInterests = 0;
+  face.onSendInterest.connect([&](const Interest& interest) {
+    if (++nInterests % LOSS_INTERVAL == 0)
+      return;
+
+    scheduler.schedule(LINK_RTT, [&, name = interest.getName()] {
+      Data data(name);
+      keyChain.sign(data, security::signingWithSha256());
+      face.receive(data);
+    });
+  });
+
+  size_t nDone = 0;
+  time::nanoseconds totalLatency(0);
+  time::nanoseconds maxLatency(0);
+
+  auto elapsed = timedExecute([&] {
+    for (size_t i = 0; i < N_FETCHES; i++) {
+      Interest interest(Name("/producer/data").appendNumber(i));
+      interest.setInterestLifetime(2_s);
+
+      auto start = time::steady_clock::now();
+      auto onDone = [&, start](auto&&...) {
+        auto latency = time::steady_clock::now() - start;
+        totalLatency += latency;
+        maxLatency = std::max<time::nanoseconds>(maxLatency, latency);
+        nDone++;
+      };
+      fetcher.expressInterest(interest, onDone, onDone, onDone, 3, nullptr, "/producer");
+    }
+
+    while (nDone < N_FETCHES)
+      io.run_one();
+  });
+
+  printResult(what, N_FETCHES, N_FETCHES, elapsed);
+  std::cout << what << " (n=" << N_FETCHES << "): mean latency "
+            << time::duration_cast<time::microseconds>(totalLatency / N_FETCHES).count() << " us, max "
+            << time::duration_cast<time::milliseconds>(maxLatency).count() << " ms, "
+            << nInterests << " interests" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(FetchRecoveryBench)
+
+BOOST_AUTO_TEST_CASE(FixedLifetime)
+{
+  FetcherOptions options;
+  options.adaptiveRto = false;
+  runFetches("fixed lifetime", options);
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveRto)
+{
+  runFetches("adaptive rto", {});
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveRtoLowBound)
+{
+  // Minimum timeout suitable for sub-millisecond links
+  FetcherOptions options;
+  options.minRto = 10_ms;
+  runFetches("adaptive rto, min 10ms", options);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,140 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#define BOOST_TEST_MODULE ndn-svs group memory benchmark
+
+#include "sync-group-manager.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Track the bytes of live heap allocations; each block is prefixed
+// with its size so that the size is known when it is freed
+static std::atomic<int64_t> g_liveBytes = 0;
+static constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+void*
+operator new(std::size_t size)
+{
+  auto* block = static_cast<char*>(std::malloc(size + HEADER_SIZE));
+  if (block == nullptr)
+    throw std::bad_alloc();
+  *reinterpret_cast<std::size_t*>(block) = size;
+  g_liveBytes += size;
+  return block + HEADER_SIZE;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  if (ptr == nullptr)
+    return;
+  auto* block = static_cast<char*>(ptr) - HEADER_SIZE;
+  g_liveBytes -= *reinterpret_cast<std::size_t*>(block);
+  std::free(block);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  operator delete(ptr);
+}
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static const std::vector<size_t> N_GROUPS = { 100, 1000, 5000 };
+
+static void
+printMemory(const std::string& what, size_t nGroups, int64_t bytes, std::chrono::nanoseconds elapsed)
+{
+  printResult(what + " create", nGroups, nGroups, elapsed);
+  std::cout << what << " (n=" << nGroups << "): " << bytes / static_cast<int64_t>(nGroups)
+            << " bytes/group" << std::endl;
+}
+
+static Name
+groupPrefix(size_t i)
+{
+  return Name("/ndn/docs").appendNumber(i);
+}
+
+/**
+ * @brief Run the work queued by the groups, such as prefix registrations
+ *
+ * Packets recorded by the dummy face are dropped, as they are not part
+ * of the cost of a group.
+ */
+static void
+settle(boost::asio::io_context& io, util::DummyClientFace& face)
+{
+  io.poll();
+  io.restart();
+  face.sentInterests = {};
+  face.sentData = {};
+  face.sentNacks = {};
+}
+
+BOOST_AUTO_TEST_SUITE(GroupMemoryBench)
+
+BOOST_AUTO_TEST_CASE(Standalone)
+{
+  for (size_t n : N_GROUPS) {
+    boost::asio::io_context io;
+    util::DummyClientFace face(io);
+    settle(io, face);
+    std::vector<std::unique_ptr<SVSyncCore>> groups;
+    groups.reserve(n);
+
+    int64_t before = g_liveBytes;
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < n; i++)
+        groups.push_back(std::make_unique<SVSyncCore>(face, groupPrefix(i), [](auto&&...) {}));
+    });
+    settle(io, face);
+    printMemory("standalone", n, g_liveBytes - before, d);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Hosted)
+{
+  for (size_t n : N_GROUPS) {
+    boost::asio::io_context io;
+    util::DummyClientFace face(io);
+    settle(io, face);
+    int64_t before = g_liveBytes;
+    SyncGroupManager manager(face, "/ndn/docs");
+
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < n; i++)
+        manager.addGroup(groupPrefix(i), [](auto&&...) {});
+    });
+    settle(io, face);
+    printMemory("hosted", n, g_liveBytes - before, d);
+    BOOST_CHECK_EQUAL(manager.size(), n);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,118 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#define BOOST_TEST_MODULE ndn-svs HMAC benchmark
+
+#include "hmac-context.hpp"
+#include "version-vector.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+// Sync interests carry full vectors of these group sizes
+static const std::vector<size_t> GROUP_SIZES = { 10, 100, 1000 };
+static constexpr size_t N_ROUNDS = 10000;
+
+static Interest
+makeSyncInterest(size_t n)
+{
+  VersionVector vv;
+  for (size_t i = 0; i < n; i++)
+    vv.set(Name("/org/site/host").appendNumber(i), i + 1);
+
+  Interest interest(Name("/ndn/svs").appendVersion(2));
+  interest.setApplicationParameters(vv.encode());
+  return interest;
+}
+
+static security::SigningInfo
+makeSigningInfo()
+{
+  security::SigningInfo info;
+  info.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  info.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  return info;
+}
+
+static void
+printRate(const std::string& what, size_t groupSize, size_t nOps, std::chrono::nanoseconds elapsed)
+{
+  printResult(what, groupSize, nOps, elapsed);
+  std::cout << what << " (n=" << groupSize << "): " << nOps * 1e9 / elapsed.count() << " interests/s"
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(HmacBench)
+
+BOOST_AUTO_TEST_CASE(KeyChainTpm)
+{
+  auto info = makeSigningInfo();
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (size_t n : GROUP_SIZES) {
+    auto interest = makeSyncInterest(n);
+
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        keyChain.sign(interest, info);
+    });
+    printRate("keychain sign", n, N_ROUNDS, d);
+
+    bool isValid = true;
+    d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        isValid &= security::verifySignature(interest, keyChain.getTpm(), info.getSignerName(),
+                                             DigestAlgorithm::SHA256);
+    });
+    printRate("keychain verify", n, N_ROUNDS, d);
+    BOOST_CHECK(isValid);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PreparedContext)
+{
+  HmacContext context(makeSigningInfo());
+
+  for (size_t n : GROUP_SIZES) {
+    auto interest = makeSyncInterest(n);
+
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        context.sign(interest);
+    });
+    printRate("context sign", n, N_ROUNDS, d);
+
+    bool isValid = true;
+    d = timedExecute([&] {
+      for (size_t i = 0; i < N_ROUNDS; i++)
+        isValid &= context.verify(interest);
+    });
+    printRate("context verify", n, N_ROUNDS, d);
+    BOOST_CHECK(isValid);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
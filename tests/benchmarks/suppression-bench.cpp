@@ -0,0 +1,119 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#define BOOST_TEST_MODULE ndn-svs suppression benchmark
+
+#include "adaptive-suppression.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <iostream>
+#include <random>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static const std::vector<size_t> GROUP_SIZES = { 5, 50, 500, 5000 };
+static constexpr size_t N_ROUNDS = 200;
+
+// One-way delay between two nodes is uniform in [BASE_DELAY, BASE_DELAY + DELAY_JITTER]
+static constexpr int BASE_DELAY = 20;
+static constexpr int DELAY_JITTER = 20;
+
+struct RoundResult
+{
+  // Number of nodes that sent a reply
+  size_t nReplies;
+  // Time from detecting the outdated vector to receiving the first reply
+  int firstReplyDelay;
+};
+
+/**
+ * @brief Simulate one round of suppression
+ *
+ * All @p n nodes receive an outdated vector at time 0 and schedule a reply
+ * with the suppression timer. A node is suppressed if a reply from another
+ * node reaches it before its own timer expires.
+ */
+static RoundResult
+simulateRound(size_t n, int window, double factor, std::mt19937& rng)
+{
+  std::uniform_int_distribution<> timerDist(0, window);
+  std::uniform_int_distribution<> delayDist(BASE_DELAY, BASE_DELAY + DELAY_JITTER);
+
+  std::vector<int> timers(n);
+  for (auto& timer : timers)
+    timer = AdaptiveSuppression::curve(window, timerDist(rng), factor);
+  std::sort(timers.begin(), timers.end());
+
+  std::vector<int> sent;
+  for (int timer : timers) {
+    bool suppressed = std::any_of(sent.begin(), sent.end(),
+                                  [&](int sentAt) { return sentAt + delayDist(rng) <= timer; });
+    if (!suppressed)
+      sent.push_back(timer);
+  }
+
+  return { sent.size(), sent.front() + delayDist(rng) };
+}
+
+static void
+printRounds(const std::string& what, size_t n, size_t nReplies, int64_t firstReplyDelay)
+{
+  std::cout << what << " (n=" << n << "): "
+            << static_cast<double>(nReplies) / N_ROUNDS << " replies/round, "
+            << static_cast<double>(firstReplyDelay) / N_ROUNDS << " ms to first reply" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(SuppressionBench)
+
+BOOST_AUTO_TEST_CASE(DuplicateReplies)
+{
+  std::mt19937 rng(0);
+
+  for (size_t n : GROUP_SIZES) {
+    // Fixed window and curve factor
+    size_t nReplies = 0;
+    int64_t firstReplyDelay = 0;
+    for (size_t round = 0; round < N_ROUNDS; round++) {
+      auto result = simulateRound(n, 500, AdaptiveSuppression::DEFAULT_CURVE_FACTOR, rng);
+      nReplies += result.nReplies;
+      firstReplyDelay += result.firstReplyDelay;
+    }
+    printRounds("fixed", n, nReplies, firstReplyDelay);
+
+    // Adaptive; every node publishes, and the replies are counted
+    AdaptiveSuppression as(500_ms, 2_s);
+    for (size_t i = 0; i < n; i++)
+      as.onNodeActive(static_cast<NodeHandle>(i));
+
+    nReplies = 0;
+    firstReplyDelay = 0;
+    for (size_t round = 0; round < N_ROUNDS; round++) {
+      auto result = simulateRound(n, as.getWindow().count(), as.getCurveFactor(), rng);
+      as.onSuppressionEnd(result.nReplies);
+      nReplies += result.nReplies;
+      firstReplyDelay += result.firstReplyDelay;
+    }
+    printRounds("adaptive", n, nReplies, firstReplyDelay);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,52 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef NDN_SVS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
+#define NDN_SVS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace ndn::tests {
+
+/**
+ * @brief Run @p f once and return the elapsed wall time
+ */
+template<typename F>
+std::chrono::nanoseconds
+timedExecute(const F& f)
+{
+  auto before = std::chrono::steady_clock::now();
+  f();
+  auto after = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(after - before);
+}
+
+/**
+ * @brief Print a single benchmark result as nanoseconds per operation
+ */
+inline void
+printResult(const std::string& what, size_t groupSize, size_t nOps, std::chrono::nanoseconds elapsed)
+{
+  std::cout << what << " (n=" << groupSize << "): "
+            << static_cast<double>(elapsed.count()) / nOps << " ns/op" << std::endl;
+}
+
+} // namespace ndn::tests
+
+#endif // NDN_SVS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
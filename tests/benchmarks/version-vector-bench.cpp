@@ -0,0 +1,232 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#define BOOST_TEST_MODULE ndn-svs version vector benchmark
+
+#include "core.hpp"
+#include "version-vector.hpp"
+
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/boost-test.hpp"
+
+#include <random>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+static const std::vector<size_t> GROUP_SIZES = { 1000, 10000, 100000 };
+
+/**
+ * @brief Generate NodeIDs sharing long common prefixes, in sorted order
+ */
+static std::vector<NodeID>
+makeNodeIds(size_t n)
+{
+  std::vector<NodeID> ids;
+  ids.reserve(n);
+  for (size_t i = 0; i < n; i++)
+    ids.push_back(Name("/org/site").appendNumber(i / 1000).append("host").appendNumber(i));
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+/**
+ * @brief Previous two-pass merge, with a lookup per entry of both vectors
+ *
+ * Kept as a baseline for the merge-join in SVSyncCore::mergeStateVector.
+ */
+static bool
+mergeTwoPass(VersionVector& local, const VersionVector& other, time::milliseconds maxSuppressionTime)
+{
+  for (const auto& entry : other) {
+    if (local.get(entry.first) < entry.second)
+      local.set(entry.first, entry.second);
+  }
+
+  for (const auto& entry : local) {
+    if (time::system_clock::now() - local.getLastUpdate(entry.first) < maxSuppressionTime)
+      continue;
+    if (other.get(entry.first) < entry.second)
+      return true;
+  }
+  return false;
+}
+
+BOOST_AUTO_TEST_SUITE(VersionVectorBench)
+
+BOOST_AUTO_TEST_CASE(SetGet)
+{
+  for (size_t n : GROUP_SIZES) {
+    auto ids = makeNodeIds(n);
+    VersionVector vv;
+
+    auto d = timedExecute([&] {
+      for (const auto& id : ids)
+        vv.set(id, 1);
+    });
+    printResult("set (insert)", n, n, d);
+    BOOST_CHECK_EQUAL(vv.size(), n);
+
+    d = timedExecute([&] {
+      for (const auto& id : ids)
+        vv.set(id, 2);
+    });
+    printResult("set (update)", n, n, d);
+
+    SeqNo sum = 0;
+    d = timedExecute([&] {
+      for (const auto& id : ids)
+        sum += vv.get(id);
+    });
+    printResult("get", n, n, d);
+    BOOST_CHECK_EQUAL(sum, 2 * n);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  for (size_t n : GROUP_SIZES) {
+    auto ids = makeNodeIds(n);
+    VersionVector vv;
+    for (const auto& id : ids)
+      vv.set(id, 1);
+
+    Block wire;
+    auto d = timedExecute([&] { wire = vv.encode(); });
+    printResult("encode", n, n, d);
+
+    std::optional<VersionVector> decoded;
+    d = timedExecute([&] { decoded.emplace(wire); });
+    printResult("decode", n, n, d);
+    BOOST_CHECK_EQUAL(decoded->size(), n);
+
+    std::optional<StateVectorView> view;
+    d = timedExecute([&] { view.emplace(wire); });
+    printResult("decode (view)", n, n, d);
+    BOOST_CHECK_EQUAL(view->size(), n);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalEncode)
+{
+  constexpr size_t N_ROUNDS = 100;
+  std::mt19937 rng(0);
+
+  for (size_t n : GROUP_SIZES) {
+    auto ids = makeNodeIds(n);
+    VersionVector vv;
+    for (const auto& id : ids)
+      vv.set(id, 1);
+    vv.encode();
+
+    // Number of entries updated between two consecutive encodings
+    for (size_t nUpdates : { size_t(0), size_t(1), n / 100, n }) {
+      std::uniform_int_distribution<size_t> dist(0, n - 1);
+      std::chrono::nanoseconds total(0);
+      SeqNo seq = 1;
+
+      for (size_t round = 0; round < N_ROUNDS; round++) {
+        ++seq;
+        for (size_t i = 0; i < nUpdates; i++)
+          vv.set(ids[nUpdates == n ? i : dist(rng)], seq);
+
+        total += timedExecute([&] { vv.encode(); });
+      }
+
+      printResult("encode after " + std::to_string(nUpdates) + " updates", n, N_ROUNDS, total);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Merge)
+{
+  for (size_t n : GROUP_SIZES) {
+    auto ids = makeNodeIds(n);
+
+    Face face;
+    SVSyncCore core(face, "/ndn/bench", [](auto&&...) {});
+
+    VersionVector initial;
+    for (const auto& id : ids)
+      initial.set(id, 1);
+    core.mergeStateVector(initial);
+
+    // Incoming vector with 1% of the entries newer than local state
+    VersionVector incoming;
+    for (size_t i = 0; i < n; i++)
+      incoming.set(ids[i], i % 100 == 0 ? 2 : 1);
+
+    SVSyncCore::MergeResult result;
+    auto d = timedExecute([&] { result = core.mergeStateVector(incoming); });
+    printResult("merge", n, n, d);
+    BOOST_CHECK_EQUAL(result.missingInfo.size(), (n + 99) / 100);
+
+    // Same incoming state, decoded lazily from the wire
+    for (size_t i = 0; i < n; i += 100)
+      incoming.set(ids[i], 3);
+    Block wire = incoming.encode();
+
+    d = timedExecute([&] { result = core.mergeStateVector(StateVectorView(wire)); });
+    printResult("merge (view)", n, n, d);
+    BOOST_CHECK_EQUAL(result.missingInfo.size(), (n + 99) / 100);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MergeJoin)
+{
+  for (size_t n : GROUP_SIZES) {
+    auto ids = makeNodeIds(n);
+
+    // Local state is older than the incoming vector for 1% of the entries
+    // and newer for none, so both walks run to the end
+    VersionVector initial;
+    for (const auto& id : ids)
+      initial.set(id, 1);
+    initial = VersionVector(initial.encode());
+
+    VersionVector incoming;
+    for (size_t i = 0; i < n; i++)
+      incoming.set(ids[i], i % 100 == 0 ? 2 : 1);
+
+    VersionVector local = initial;
+    auto d = timedExecute([&] { mergeTwoPass(local, incoming, 500_ms); });
+    printResult("merge (two-pass lookup)", n, n, d);
+
+    Face face;
+    SVSyncCore core(face, "/ndn/bench", [](auto&&...) {});
+    core.setState(initial);
+
+    SVSyncCore::MergeResult result;
+    d = timedExecute([&] { result = core.mergeStateVector(incoming); });
+    printResult("merge (merge-join)", n, n, d);
+    BOOST_CHECK(!result.myVectorNew);
+    BOOST_CHECK_EQUAL(result.missingInfo.size(), (n + 99) / 100);
+
+    // Identical vectors, the common case in steady state
+    d = timedExecute([&] { result = core.mergeStateVector(incoming); });
+    printResult("merge identical (merge-join)", n, n, d);
+    BOOST_CHECK(result.missingInfo.empty());
+
+    d = timedExecute([&] { mergeTwoPass(local, incoming, 500_ms); });
+    printResult("merge identical (two-pass lookup)", n, n, d);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,80 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#ifndef NDN_SVS_TESTS_CLOCK_FIXTURE_HPP
+#define NDN_SVS_TESTS_CLOCK_FIXTURE_HPP
+
+#include <ndn-cxx/util/time-unit-test-clock.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <algorithm>
+
+namespace ndn::tests {
+
+/**
+ * @brief Fixture that replaces the clocks of ndn-cxx with unit-test clocks
+ *
+ * Time only passes in advanceClocks(), which runs the handlers of m_io
+ * that became due after each tick, so timers fire in a deterministic order.
+ */
+class ClockFixture
+{
+public:
+  virtual ~ClockFixture()
+  {
+    time::setCustomClocks(nullptr, nullptr);
+  }
+
+  /// @brief Advance the clocks by @p nTicks times @p tick
+  void advanceClocks(time::nanoseconds tick, size_t nTicks = 1)
+  {
+    advanceClocks(tick, tick * nTicks);
+  }
+
+  /// @brief Advance the clocks by @p total, in steps of at most @p tick
+  void advanceClocks(time::nanoseconds tick, time::nanoseconds total)
+  {
+    BOOST_ASSERT(tick > time::nanoseconds::zero());
+
+    while (total > time::nanoseconds::zero()) {
+      auto step = std::min(tick, total);
+      m_steadyClock->advance(step);
+      m_systemClock->advance(step);
+      total -= step;
+
+      m_io.restart();
+      m_io.poll();
+    }
+  }
+
+protected:
+  ClockFixture()
+    : m_steadyClock(std::make_shared<time::UnitTestSteadyClock>())
+    , m_systemClock(std::make_shared<time::UnitTestSystemClock>())
+  {
+    time::setCustomClocks(m_steadyClock, m_systemClock);
+  }
+
+protected:
+  std::shared_ptr<time::UnitTestSteadyClock> m_steadyClock;
+  std::shared_ptr<time::UnitTestSystemClock> m_systemClock;
+  boost::asio::io_context m_io;
+};
+
+} // namespace ndn::tests
+
+#endif // NDN_SVS_TESTS_CLOCK_FIXTURE_HPP
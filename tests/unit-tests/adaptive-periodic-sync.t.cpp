@@ -0,0 +1,87 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "adaptive-periodic-sync.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestAdaptivePeriodicSync)
+
+BOOST_AUTO_TEST_CASE(Quiescent)
+{
+  auto now = time::steady_clock::now();
+  AdaptivePeriodicSync aps(30_s, 5_s, 120_s, now);
+  BOOST_CHECK_EQUAL(aps.getInterval().count(), 30000);
+
+  // Not adjusted before the interval elapsed
+  BOOST_CHECK_EQUAL(aps.nextInterval(now + 10_s).count(), 30000);
+
+  // Nothing happened in the interval
+  now += 30_s;
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 45000);
+
+  // Bounded by the maximum
+  for (int i = 0; i < 10; i++) {
+    now += aps.getInterval();
+    aps.nextInterval(now);
+  }
+  BOOST_CHECK_EQUAL(aps.getInterval().count(), 120000);
+
+  // Activity resets to the base interval
+  aps.onStateChanged();
+  now += aps.getInterval();
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 30000);
+}
+
+BOOST_AUTO_TEST_CASE(Diverged)
+{
+  auto now = time::steady_clock::now();
+  AdaptivePeriodicSync aps(30_s, 5_s, 120_s, now);
+
+  // A peer missing state halves the interval
+  aps.onStateChanged();
+  aps.onStateDiverged();
+  now += 30_s;
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 15000);
+
+  // Bounded by the minimum
+  for (int i = 0; i < 10; i++) {
+    aps.onStateDiverged();
+    now += aps.getInterval();
+    aps.nextInterval(now);
+  }
+  BOOST_CHECK_EQUAL(aps.getInterval().count(), 5000);
+
+  // Consistent updates return to the base interval
+  aps.onStateChanged();
+  now += aps.getInterval();
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 10000);
+  aps.onStateChanged();
+  now += aps.getInterval();
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 20000);
+  aps.onStateChanged();
+  now += aps.getInterval();
+  BOOST_CHECK_EQUAL(aps.nextInterval(now).count(), 30000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,98 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "adaptive-suppression.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestAdaptiveSuppression)
+
+BOOST_AUTO_TEST_CASE(Curve)
+{
+  // The curve maps [0, window] to [0, window], decreasing
+  BOOST_CHECK_EQUAL(AdaptiveSuppression::curve(500, 500, 10), 0);
+  BOOST_CHECK_LE(AdaptiveSuppression::curve(500, 0, 10), 500);
+  BOOST_CHECK_GE(AdaptiveSuppression::curve(500, 0, 10), 499);
+  BOOST_CHECK_GT(AdaptiveSuppression::curve(500, 250, 2), AdaptiveSuppression::curve(500, 400, 2));
+
+  // A steeper curve keeps more values close to the window
+  BOOST_CHECK_GT(AdaptiveSuppression::curve(500, 400, 20), AdaptiveSuppression::curve(500, 400, 2));
+
+  BOOST_CHECK_EQUAL(AdaptiveSuppression::curve(0, 0, 10), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CurveFactor)
+{
+  BOOST_CHECK_GE(AdaptiveSuppression::curveFactorFor(1), 1.0);
+  BOOST_CHECK_LT(AdaptiveSuppression::curveFactorFor(5), AdaptiveSuppression::curveFactorFor(50));
+  BOOST_CHECK_LT(AdaptiveSuppression::curveFactorFor(50), AdaptiveSuppression::curveFactorFor(5000));
+  BOOST_CHECK_CLOSE(AdaptiveSuppression::curveFactorFor(150), AdaptiveSuppression::DEFAULT_CURVE_FACTOR, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ActiveNodes)
+{
+  AdaptiveSuppression as(500_ms, 10_s);
+  auto now = time::steady_clock::now();
+  BOOST_CHECK_EQUAL(as.getActiveNodes(now), 1);
+
+  as.onNodeActive(1, now);
+  as.onNodeActive(2, now);
+  as.onNodeActive(3, now + 5_s);
+  as.onNodeActive(1, now + 5_s);
+  BOOST_CHECK_EQUAL(as.getActiveNodes(now + 5_s), 3);
+
+  // Node 2 is no longer active
+  BOOST_CHECK_EQUAL(as.getActiveNodes(now + 12_s), 2);
+  BOOST_CHECK_EQUAL(as.getActiveNodes(now + 20_s), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Window)
+{
+  AdaptiveSuppression as(500_ms, 1_s);
+  BOOST_CHECK_EQUAL(as.getWindow().count(), 500);
+
+  // Too many replies widen the window
+  as.onSuppressionEnd(5);
+  BOOST_CHECK_GT(as.getWindow().count(), 500);
+
+  // Two replies are fine
+  auto window = as.getWindow();
+  as.onSuppressionEnd(2);
+  BOOST_CHECK_EQUAL(as.getWindow().count(), window.count());
+
+  // A single reply narrows the window slowly
+  as.onSuppressionEnd(1);
+  BOOST_CHECK_LT(as.getWindow().count(), window.count());
+  BOOST_CHECK_GT(as.getWindow().count(), window.count() / 2);
+
+  // Bounded in both directions
+  for (int i = 0; i < 100; i++)
+    as.onSuppressionEnd(10);
+  BOOST_CHECK_EQUAL(as.getWindow().count(), 1000);
+
+  for (int i = 0; i < 1000; i++)
+    as.onSuppressionEnd(1);
+  BOOST_CHECK_EQUAL(as.getWindow().count(), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
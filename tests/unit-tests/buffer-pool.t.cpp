@@ -0,0 +1,99 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "buffer-pool.hpp"
+#include "core.hpp"
+#include "tlv.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestBufferPool)
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+  BufferPool pool(2);
+
+  auto buffer = pool.acquire(100);
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+
+  // Released buffers are reused with their capacity
+  buffer = pool.acquire(50);
+  BOOST_CHECK(buffer->data() == data);
+  BOOST_CHECK_EQUAL(buffer->size(), 50);
+
+  // Referenced buffers are not
+  auto other = pool.acquire(50);
+  BOOST_CHECK(other->data() != data);
+  auto unpooled = pool.acquire(50);
+  BOOST_CHECK(unpooled->data() != data);
+  BOOST_CHECK(unpooled->data() != other->data());
+}
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  BufferPool pool;
+  auto first = ndn::encoding::makeStringBlock(ndn::tlv::Content, "first");
+  auto second = ndn::encoding::makeNonNegativeIntegerBlock(ndn::tlv::Content, 300);
+
+  auto block = pool.encode(ndn::tlv::ApplicationParameters, { &first, nullptr, &second });
+  BOOST_CHECK_EQUAL(block.type(), ndn::tlv::ApplicationParameters);
+  BOOST_CHECK_EQUAL(block.value_size(), first.size() + second.size());
+
+  block.parse();
+  BOOST_REQUIRE_EQUAL(block.elements_size(), 2);
+  BOOST_CHECK(block.elements()[0] == first);
+  BOOST_CHECK(block.elements()[1] == second);
+
+  // Long values need a longer length field
+  Block large = ndn::encoding::makeBinaryBlock(ndn::tlv::Content, std::vector<uint8_t>(70000));
+  block = pool.encode(ndn::tlv::ApplicationParameters, { &large });
+  BOOST_CHECK_EQUAL(block.size(), large.size() + 6);
+  block.parse();
+  BOOST_CHECK(block.elements().at(0) == large);
+}
+
+BOOST_AUTO_TEST_CASE(SyncParameters)
+{
+  Face face;
+  SVSyncCore core(face, "/ndn/test", [](auto&&...) {});
+
+  VersionVector vv;
+  for (int i = 0; i < 100; i++)
+    vv.set(Name("/node").appendNumber(i), i + 1);
+  core.setState(vv);
+
+  // Copy the result to release the pooled buffer
+  auto vvWire = core.getState()->encode();
+  auto params = core.encodeSyncParameters(vvWire, Block(), false);
+  Block expected(span<const uint8_t>(params.data(), params.size()));
+  params = Block();
+
+  // The reused buffer yields the same encoding
+  params = core.encodeSyncParameters(vvWire, Block(), false);
+  BOOST_CHECK(params == expected);
+  params.parse();
+  BOOST_CHECK(params.get(svs::tlv::StateVector) == vvWire);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
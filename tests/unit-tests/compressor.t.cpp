@@ -0,0 +1,116 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "compressor.hpp"
+#include "tlv.hpp"
+#include "version-vector.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+class CompressorFixture
+{
+protected:
+  CompressorFixture()
+  {
+    for (size_t i = 0; i < 100; i++)
+      vv.set(Name("/org/site").appendNumber(i), i + 1);
+  }
+
+  void
+  checkRoundTrip(Compressor& compressor)
+  {
+    auto wire = vv.encode();
+    auto compressed = compressor.compress({ wire.data(), wire.size() });
+    BOOST_CHECK_EQUAL(compressed.type(), compressor.getType());
+    BOOST_CHECK_LT(compressed.size(), wire.size());
+
+    auto decompressed = compressor.decompress(compressed.value_bytes());
+    BOOST_CHECK_EQUAL_COLLECTIONS(decompressed->begin(), decompressed->end(), wire.begin(), wire.end());
+
+    // Contexts are reused across calls
+    auto again = compressor.compress({ wire.data(), wire.size() });
+    BOOST_CHECK(again == compressed);
+  }
+
+protected:
+  VersionVector vv;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCompressor, CompressorFixture)
+
+#ifdef NDN_SVS_COMPRESSION
+BOOST_AUTO_TEST_CASE(Lzma)
+{
+  LzmaCompressor lzma;
+  BOOST_CHECK_EQUAL(lzma.getType(), svs::tlv::LzmaBlock);
+  checkRoundTrip(lzma);
+
+  const uint8_t garbage[] = { 0x01, 0x02, 0x03 };
+  BOOST_CHECK_THROW(lzma.decompress(garbage), Compressor::Error);
+
+  // Highly compressible input above the limit is rejected
+  std::vector<uint8_t> zeros(Compressor::MAX_DECOMPRESSED_SIZE + 1);
+  auto bomb = lzma.compress(zeros);
+  BOOST_CHECK_LT(bomb.size(), 1024);
+  BOOST_CHECK_THROW(lzma.decompress(bomb.value_bytes()), Compressor::Error);
+}
+#endif
+
+#ifdef NDN_SVS_HAVE_ZSTD
+BOOST_AUTO_TEST_CASE(Zstd)
+{
+  ZstdCompressor zstd;
+  BOOST_CHECK_EQUAL(zstd.getType(), svs::tlv::ZstdBlock);
+  checkRoundTrip(zstd);
+
+  const uint8_t garbage[] = { 0x01, 0x02, 0x03 };
+  BOOST_CHECK_THROW(zstd.decompress(garbage), Compressor::Error);
+}
+
+BOOST_AUTO_TEST_CASE(ZstdDictionary)
+{
+  // Train on vectors of the same shape with different sequence numbers
+  std::vector<Block> samples;
+  for (size_t i = 0; i < 200; i++) {
+    VersionVector sample;
+    for (size_t j = 0; j < 20 + i % 50; j++)
+      sample.set(Name("/org/site").appendNumber(j), i * j + 1);
+    samples.push_back(sample.encode());
+  }
+
+  auto dictionary = ZstdCompressor::trainDictionary(samples, 4096);
+  BOOST_CHECK_GT(dictionary.size(), 0);
+  BOOST_CHECK_LE(dictionary.size(), 4096);
+
+  ZstdCompressor withDict(1, dictionary);
+  checkRoundTrip(withDict);
+
+  // The dictionary is needed for decompression
+  auto wire = vv.encode();
+  auto compressed = withDict.compress({ wire.data(), wire.size() });
+  ZstdCompressor withoutDict;
+  BOOST_CHECK_THROW(withoutDict.decompress(compressed.value_bytes()), Compressor::Error);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
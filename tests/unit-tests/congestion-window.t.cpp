@@ -0,0 +1,124 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#include "congestion-window.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestCongestionWindow)
+
+BOOST_AUTO_TEST_CASE(SlowStart)
+{
+  CongestionWindowOptions opts;
+  opts.initialWindow = 2;
+  opts.maxWindow = 8;
+  CongestionWindow window(opts);
+  BOOST_CHECK_EQUAL(window.getLimit(), 2);
+  BOOST_CHECK(window.isSlowStart());
+
+  // One more interest per Data, up to the maximum
+  for (int i = 0; i < 4; i++)
+    window.onData(window.getLimit());
+  BOOST_CHECK_EQUAL(window.getLimit(), 6);
+  for (int i = 0; i < 4; i++)
+    window.onData(window.getLimit());
+  BOOST_CHECK_EQUAL(window.getWindow(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(AdditiveIncrease)
+{
+  CongestionWindowOptions opts;
+  opts.initialWindow = 4;
+  opts.slowStart = false;
+  CongestionWindow window(opts);
+  BOOST_CHECK(!window.isSlowStart());
+
+  // One more interest per window of Data
+  for (int i = 0; i < 4; i++)
+    window.onData(window.getLimit());
+  BOOST_CHECK_GT(window.getWindow(), 4.9);
+  BOOST_CHECK_LT(window.getWindow(), 5);
+  window.onData(window.getLimit());
+  BOOST_CHECK_EQUAL(window.getLimit(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(ApplicationLimited)
+{
+  CongestionWindowOptions opts;
+  opts.initialWindow = 4;
+  CongestionWindow window(opts);
+
+  // Data of a window that is not fully used does not grow it
+  for (int i = 0; i < 10; i++)
+    window.onData(3);
+  BOOST_CHECK_EQUAL(window.getWindow(), 4);
+  window.onData(4);
+  BOOST_CHECK_EQUAL(window.getWindow(), 5);
+
+  // The same holds in congestion avoidance, against the integral window
+  window.onCongestion(1, 10);
+  BOOST_CHECK_EQUAL(window.getWindow(), 2.5);
+  window.onData(1);
+  BOOST_CHECK_EQUAL(window.getWindow(), 2.5);
+  window.onData(2);
+  BOOST_CHECK_EQUAL(window.getWindow(), 2.9);
+}
+
+BOOST_AUTO_TEST_CASE(MultiplicativeDecrease)
+{
+  CongestionWindowOptions opts;
+  opts.initialWindow = 16;
+  opts.minWindow = 2;
+  CongestionWindow window(opts);
+
+  // Interests 1-16 are in flight; their losses are one event
+  BOOST_CHECK(window.onCongestion(3, 16));
+  BOOST_CHECK_EQUAL(window.getWindow(), 8);
+  BOOST_CHECK(!window.isSlowStart());
+  BOOST_CHECK(!window.onCongestion(5, 16));
+  BOOST_CHECK(!window.onCongestion(16, 16));
+  BOOST_CHECK_EQUAL(window.getWindow(), 8);
+
+  // Interests sent after the decrease count again, down to the minimum
+  window.onCongestion(17, 20);
+  BOOST_CHECK_EQUAL(window.getWindow(), 4);
+  window.onCongestion(21, 22);
+  window.onCongestion(23, 24);
+  BOOST_CHECK_EQUAL(window.getWindow(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidOptions)
+{
+  CongestionWindowOptions opts;
+  opts.minWindow = 0;
+  BOOST_CHECK_THROW(CongestionWindow{ opts }, CongestionWindow::Error);
+
+  opts = {};
+  opts.initialWindow = 2000;
+  BOOST_CHECK_THROW(CongestionWindow{ opts }, CongestionWindow::Error);
+
+  opts = {};
+  opts.multiplicativeDecrease = 1;
+  BOOST_CHECK_THROW(CongestionWindow{ opts }, CongestionWindow::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -15,14 +15,24 @@
  */
 
 #include "core.hpp"
+#include "tlv.hpp"
 
 #include "tests/boost-test.hpp"
+#include "tests/clock-fixture.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <algorithm>
+#include <thread>
 
 namespace ndn::tests {
 
 using namespace ndn::svs;
 
-class CoreFixture
+class CoreFixture : public ClockFixture
 {
 protected:
   CoreFixture()
@@ -43,7 +53,7 @@ BOOST_AUTO_TEST_CASE(MergeStateVector)
 {
   std::vector<MissingDataInfo> missingInfo;
 
-  VersionVector v = m_core.getState();
+  VersionVector v = *m_core.getState();
   BOOST_CHECK_EQUAL(v.get("one"), 0);
   BOOST_CHECK_EQUAL(v.get("two"), 0);
   BOOST_CHECK_EQUAL(v.get("three"), 0);
@@ -54,7 +64,7 @@ BOOST_AUTO_TEST_CASE(MergeStateVector)
   v1.set("two", 2);
   missingInfo = m_core.mergeStateVector(v1).missingInfo;
 
-  v = m_core.getState();
+  v = *m_core.getState();
   BOOST_CHECK_EQUAL(v.get("one"), 1);
   BOOST_CHECK_EQUAL(v.get("two"), 2);
   BOOST_CHECK_EQUAL(v.get("three"), 0);
@@ -66,7 +76,7 @@ BOOST_AUTO_TEST_CASE(MergeStateVector)
   v2.set("three", 3);
   missingInfo = m_core.mergeStateVector(v2).missingInfo;
 
-  v = m_core.getState();
+  v = *m_core.getState();
   BOOST_CHECK_EQUAL(v.get("one"), 1);
   BOOST_CHECK_EQUAL(v.get("two"), 2);
   BOOST_CHECK_EQUAL(v.get("three"), 3);
@@ -75,6 +85,872 @@ BOOST_AUTO_TEST_CASE(MergeStateVector)
   BOOST_CHECK_EQUAL(missingInfo[0].nodeId, "three");
   BOOST_CHECK_EQUAL(missingInfo[0].low, 1);
   BOOST_CHECK_EQUAL(missingInfo[0].high, 3);
+  BOOST_CHECK_EQUAL(missingInfo[0].nodeHandle, m_core.getNodeIdRegistry()->intern("three"));
+}
+
+BOOST_AUTO_TEST_CASE(MergeStateVectorView)
+{
+  VersionVector v1;
+  v1.set("one", 1);
+  v1.set("two", 2);
+  auto result = m_core.mergeStateVector(StateVectorView(v1.encode()));
+  BOOST_CHECK(result.otherVectorNew);
+  BOOST_CHECK_EQUAL(result.missingInfo.size(), 2);
+
+  VersionVector v2;
+  v2.set("one", 1);
+  v2.set("two", 1);
+  v2.set("three", 3);
+  result = m_core.mergeStateVector(StateVectorView(v2.encode()));
+
+  VersionVector v = *m_core.getState();
+  BOOST_CHECK_EQUAL(v.get("one"), 1);
+  BOOST_CHECK_EQUAL(v.get("two"), 2);
+  BOOST_CHECK_EQUAL(v.get("three"), 3);
+
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].nodeId, "three");
+  BOOST_CHECK_EQUAL(result.missingInfo[0].low, 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].high, 3);
+}
+
+BOOST_AUTO_TEST_CASE(MergePartialStateVector)
+{
+  // Restored entries are not recently updated after the suppression time
+  VersionVector local;
+  local.set("one", 1);
+  local.set("two", 2);
+  m_core.setState(VersionVector(local.encode()));
+  advanceClocks(1_s);
+
+  VersionVector other;
+  other.set("one", 1);
+  Block otherWire = other.encode();
+
+  // "two" is absent: older if full, unknown if partial
+  BOOST_CHECK(m_core.mergeStateVector(StateVectorView(otherWire)).myVectorNew);
+  BOOST_CHECK(!m_core.mergeStateVector(StateVectorView(otherWire), true).myVectorNew);
+  BOOST_CHECK(!m_core.mergeStateVector(other, true).myVectorNew);
+
+  // "two" is present and older
+  other.set("two", 1);
+  BOOST_CHECK(m_core.mergeStateVector(StateVectorView(other.encode()), true).myVectorNew);
+  BOOST_CHECK(m_core.mergeStateVector(other, true).myVectorNew);
+}
+
+BOOST_AUTO_TEST_CASE(MergeInterleaved)
+{
+  // Restored entries are not recently updated after the suppression time
+  VersionVector local;
+  local.set("/b", 1);
+  local.set("/d", 5);
+  local.set("/f", 1);
+
+  VersionVector other;
+  other.set("/a", 2);
+  other.set("/b", 3);
+  other.set("/c", 1);
+  other.set("/d", 5);
+  other.set("/f", 1);
+  other.set("/g", 4);
+
+  for (bool useView : { false, true }) {
+    m_core.setState(VersionVector(local.encode()));
+    advanceClocks(1_s);
+    auto result = useView ? m_core.mergeStateVector(StateVectorView(other.encode()))
+                          : m_core.mergeStateVector(other);
+
+    BOOST_CHECK(result.otherVectorNew);
+    BOOST_CHECK(!result.myVectorNew);
+    BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 4);
+    BOOST_CHECK_EQUAL(result.missingInfo[0].nodeId, "/a");
+    BOOST_CHECK_EQUAL(result.missingInfo[1].nodeId, "/b");
+    BOOST_CHECK_EQUAL(result.missingInfo[1].low, 2);
+    BOOST_CHECK_EQUAL(result.missingInfo[1].high, 3);
+    BOOST_CHECK_EQUAL(result.missingInfo[2].nodeId, "/c");
+    BOOST_CHECK_EQUAL(result.missingInfo[3].nodeId, "/g");
+
+    BOOST_CHECK_EQUAL(m_core.getState()->size(), 6);
+    BOOST_CHECK_EQUAL(m_core.getSeqNo("/a"), 2);
+    BOOST_CHECK_EQUAL(m_core.getSeqNo("/b"), 3);
+    BOOST_CHECK_EQUAL(m_core.getSeqNo("/g"), 4);
+  }
+
+  // Local entry missing from the other vector
+  VersionVector older;
+  older.set("/b", 1);
+  older.set("/f", 1);
+  m_core.setState(VersionVector(local.encode()));
+  advanceClocks(1_s);
+  BOOST_CHECK(m_core.mergeStateVector(older).myVectorNew);
+  BOOST_CHECK(m_core.mergeStateVector(StateVectorView(older.encode())).myVectorNew);
+}
+
+BOOST_AUTO_TEST_CASE(MergeUnsortedView)
+{
+  // "two" is encoded before "one"
+  constexpr std::string_view encoded{ "\xCA\x0A\x07\x05\x08\x03\x74\x77\x6F\xCC\x01\x02"
+                                      "\xCA\x0A\x07\x05\x08\x03\x6F\x6E\x65\xCC\x01\x01" };
+  StateVectorView view(ndn::encoding::makeStringBlock(svs::tlv::StateVector, encoded));
+  BOOST_REQUIRE(!view.isSorted());
+
+  auto result = m_core.mergeStateVector(view);
+  BOOST_CHECK_EQUAL(result.missingInfo.size(), 2);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("one"), 1);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("two"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(StateSnapshot)
+{
+  m_core.updateSeqNo(1, "one");
+  auto snapshot = m_core.getState();
+  BOOST_CHECK_EQUAL(snapshot->get("one"), 1);
+
+  // Updates publish a new snapshot and leave old ones untouched
+  m_core.updateSeqNo(2, "one");
+  VersionVector v1;
+  v1.set("two", 5);
+  m_core.mergeStateVector(v1);
+
+  BOOST_CHECK_EQUAL(snapshot->get("one"), 1);
+  BOOST_CHECK_EQUAL(snapshot->size(), 1);
+  BOOST_CHECK_EQUAL(m_core.getState()->get("one"), 2);
+  BOOST_CHECK_EQUAL(m_core.getState()->get("two"), 5);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("two"), 5);
+  BOOST_CHECK(m_core.getState() != snapshot);
+
+  // Merges without new state keep the snapshot
+  auto current = m_core.getState();
+  m_core.mergeStateVector(v1);
+  BOOST_CHECK(m_core.getState() == current);
+}
+
+BOOST_AUTO_TEST_CASE(DigestFastPath)
+{
+  VersionVector local;
+  local.set("one", 1);
+  local.set("two", 2);
+  m_core.mergeStateVector(local);
+
+  auto receive = [this](const VersionVector& vv) {
+    Interest interest(Name(m_syncPrefix).appendVersion(2));
+    interest.setApplicationParameters(vv.encode());
+    m_core.onSyncInterestValidated(interest);
+  };
+
+  // Identical vector is not merged
+  receive(local);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 1);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDigestHits, 1);
+
+  // Newer vector is merged
+  VersionVector other = local;
+  other.set("two", 3);
+  receive(other);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 2);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDigestHits, 1);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("two"), 3);
+
+  // Identical again after the merge
+  receive(other);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDigestHits, 2);
+
+  // A digest match is not trusted forever; identical vectors are merged in full now and then
+  for (int i = 0; i < 100; i++)
+    receive(other);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 103);
+  BOOST_CHECK_GT(m_core.getCounters().nDigestHits, 2 + 80);
+  BOOST_CHECK_LT(m_core.getCounters().nDigestHits, 2 + 100);
+}
+
+BOOST_AUTO_TEST_CASE(RecvExtraBlock)
+{
+  VersionVector vv;
+  vv.set("one", 1);
+  vv.set("two", 2);
+
+  auto receive = [this, &vv] {
+    Block params(ndn::tlv::ApplicationParameters);
+    params.push_back(vv.encode());
+    params.push_back(ndn::encoding::makeStringBlock(svs::tlv::MappingData, "extra"));
+    params.encode();
+
+    Interest interest(Name(m_syncPrefix).appendVersion(2));
+    interest.setApplicationParameters(params);
+    m_core.onSyncInterestValidated(interest);
+  };
+
+  // Callbacks taking a VersionVector keep working
+  Block extra;
+  VersionVector received;
+  m_core.setRecvExtraBlockCallback([&](const Block& block, const VersionVector& other) {
+    extra = block;
+    received = other;
+  });
+  receive();
+  BOOST_CHECK_EQUAL(ndn::encoding::readString(extra), "extra");
+  BOOST_CHECK_EQUAL(received.get("one"), 1);
+  BOOST_CHECK_EQUAL(received.get("two"), 2);
+
+  // Setting the view form replaces it
+  size_t nViews = 0;
+  m_core.setRecvExtraBlockViewCallback([&](const Block& block, const StateVectorView& view) {
+    ++nViews;
+    BOOST_CHECK_EQUAL(view.get("two"), 3);
+  });
+  vv.set("two", 3);
+  receive();
+  BOOST_CHECK_EQUAL(nViews, 1);
+  BOOST_CHECK_EQUAL(received.get("two"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(CompressedParameters)
+{
+  auto receive = [this](const Block& compressed) {
+    Interest interest(Name(m_syncPrefix).appendVersion(2));
+    interest.setApplicationParameters(compressed);
+    m_core.onSyncInterestValidated(interest);
+  };
+
+  // Blocks that cannot be decompressed are counted
+  receive(ndn::encoding::makeStringBlock(svs::tlv::LzmaBlock, "garbage"));
+  receive(ndn::encoding::makeStringBlock(svs::tlv::ZstdBlock, "garbage"));
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDecompressionDrops, 2);
+
+  // Each compiled-in codec is accepted, whichever one is used to send
+  m_core.setCompressor(nullptr);
+  VersionVector vv;
+#ifdef NDN_SVS_COMPRESSION
+  vv.set("one", 1);
+  auto lzmaParams = m_core.encodeSyncParameters(vv.encode(), Block(), false);
+  receive(LzmaCompressor().compress({ lzmaParams.data(), lzmaParams.size() }));
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("one"), 1);
+#endif
+#ifdef NDN_SVS_HAVE_ZSTD
+  vv.set("one", 2);
+  auto zstdParams = m_core.encodeSyncParameters(vv.encode(), Block(), false);
+  receive(ZstdCompressor().compress({ zstdParams.data(), zstdParams.size() }));
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("one"), 2);
+#endif
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDecompressionDrops, 2);
+}
+
+BOOST_AUTO_TEST_CASE(DuplicateInterests)
+{
+  VersionVector vv;
+  vv.set("one", 1);
+
+  Interest interest(Name(m_syncPrefix).appendVersion(2));
+  interest.setApplicationParameters(vv.encode());
+
+  m_core.setDuplicateFilter(1_s);
+
+  // The copy is rejected before processing
+  m_core.onSyncInterest(interest);
+  m_core.onSyncInterest(interest);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 1);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateHits, 1);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateMisses, 1);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("one"), 1);
+
+  // Different parameters are not a copy
+  vv.set("two", 1);
+  Interest other(Name(m_syncPrefix).appendVersion(2));
+  other.setApplicationParameters(vv.encode());
+  m_core.onSyncInterest(other);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 2);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateMisses, 2);
+
+  // A forged copy of the digest does not keep out the genuine interest
+  VersionVector genuineVv;
+  genuineVv.set("three", 1);
+  Interest genuine(Name(m_syncPrefix).appendVersion(2));
+  genuine.setApplicationParameters(genuineVv.encode());
+  VersionVector forgedVv;
+  forgedVv.set("three", 5);
+  Interest forged(genuine);
+  forged.setApplicationParameters(forgedVv.encode());
+  forged.setName(genuine.getName());
+  BOOST_REQUIRE(!forged.isParametersDigestValid());
+
+  m_core.onSyncInterest(forged);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 2);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("three"), 0);
+  m_core.onSyncInterest(genuine);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 3);
+  BOOST_CHECK_EQUAL(m_core.getSeqNo("three"), 1);
+
+  // The signature components of v0.2 signed interests follow the digest;
+  // copies are still rejected, and other signatures of the same parameters are not
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto makeSigned = [&] {
+    VersionVector signedVv;
+    signedVv.set("four", 1);
+    Interest signedInterest(Name(m_syncPrefix).appendVersion(2));
+    signedInterest.setApplicationParameters(signedVv.encode());
+    auto signingInfo = security::signingWithSha256();
+    signingInfo.setSignedInterestFormat(security::SignedInterestFormat::V02);
+    keyChain.sign(signedInterest, signingInfo);
+    return signedInterest;
+  };
+
+  auto signedInterest = makeSigned();
+  m_core.onSyncInterest(signedInterest);
+  m_core.onSyncInterest(signedInterest);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 4);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateHits, 2);
+  m_core.onSyncInterest(makeSigned());
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 5);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateHits, 2);
+
+  // Without the filter, every copy is processed
+  m_core.setDuplicateFilter(0_ms);
+  m_core.onSyncInterest(interest);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nSyncInterests, 6);
+  BOOST_CHECK_EQUAL(m_core.getCounters().nDuplicateHits, 2);
+
+  // The filter is disabled by default
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {});
+  core.onSyncInterest(interest);
+  core.onSyncInterest(interest);
+  BOOST_CHECK_EQUAL(core.getCounters().nSyncInterests, 2);
+  BOOST_CHECK_EQUAL(core.getCounters().nDuplicateMisses, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ValidationThreads)
+{
+  // The results of the pool are posted to the face, which must be run
+  boost::asio::io_context io;
+  util::DummyClientFace face(io);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  SVSyncCore core(face, "/ndn/test2", [](auto&&...) {}, secOpts, "/self");
+  core.setValidationThreads(2);
+  HmacContext hmac(secOpts.interestSigner->signingInfo);
+
+  auto makeInterest = [](const NodeID& nid, bool isSigned, const HmacContext& context) {
+    VersionVector vv;
+    vv.set(nid, 1);
+    Interest interest(Name("/ndn/test2").appendVersion(2));
+    interest.setApplicationParameters(vv.encode());
+    if (isSigned)
+      context.sign(interest);
+    return interest;
+  };
+
+  // Verified on the pool, merged once the face processes the result
+  core.onSyncInterest(makeInterest("/one", true, hmac));
+  core.onSyncInterest(makeInterest("/two", false, hmac));
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 0);
+
+  for (int i = 0; i < 200 && core.getSeqNo("/one") == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    io.restart();
+    io.poll();
+  }
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 1);
+  BOOST_CHECK_EQUAL(core.getCounters().nSyncInterests, 1);
+
+  // Unsigned interests are never merged
+  BOOST_CHECK_EQUAL(core.getSeqNo("/two"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ValidationThreadsWithKey)
+{
+  // Trusts one key, which it hands out for verification on the pool
+  class KeyValidator : public BaseValidator
+  {
+  public:
+    explicit KeyValidator(span<const uint8_t> key)
+      : m_key(std::make_shared<Buffer>(key.begin(), key.end()))
+    {
+    }
+
+    void validate(const Interest& interest,
+                  const ndn::security::InterestValidationSuccessCallback& successCb,
+                  const ndn::security::InterestValidationFailureCallback&) override
+    {
+      nValidations++;
+      if (security::verifySignature(interest, *m_key))
+        successCb(interest);
+    }
+
+    ConstBufferPtr getVerificationKey(const Interest&) override
+    {
+      nLookups++;
+      return m_key;
+    }
+
+  public:
+    int nValidations = 0;
+    int nLookups = 0;
+
+  private:
+    ConstBufferPtr m_key;
+  };
+
+  boost::asio::io_context io;
+  util::DummyClientFace face(io);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto trusted = keyChain.createIdentity("/trusted");
+  auto other = keyChain.createIdentity("/other");
+  auto validator = std::make_shared<KeyValidator>(trusted.getDefaultKey().getPublicKey());
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo = security::signingByIdentity(trusted);
+  secOpts.validator = validator;
+  SVSyncCore core(face, "/ndn/test4", [](auto&&...) {}, secOpts, "/self");
+  core.setValidationThreads(2);
+
+  auto makeInterest = [&keyChain](const NodeID& nid, const security::pib::Identity& signer) {
+    VersionVector vv;
+    vv.set(nid, 1);
+    Interest interest(Name("/ndn/test4").appendVersion(2));
+    interest.setApplicationParameters(vv.encode());
+    auto signingInfo = security::signingByIdentity(signer);
+    signingInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+    keyChain.sign(interest, signingInfo);
+    return interest;
+  };
+
+  // The key is looked up here, and the signature verified on the pool
+  core.onSyncInterest(makeInterest("/one", trusted));
+  core.onSyncInterest(makeInterest("/two", other));
+  BOOST_CHECK_EQUAL(validator->nLookups, 2);
+
+  for (int i = 0; i < 200 && core.getSeqNo("/one") == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    io.restart();
+    io.poll();
+  }
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 1);
+  BOOST_CHECK_EQUAL(core.getSeqNo("/two"), 0);
+  BOOST_CHECK_EQUAL(validator->nValidations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(CoalescedUpdates)
+{
+  util::DummyClientFace face(m_io, { true, true });
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSha256Signing();
+  SVSyncCore core(face, "/ndn/test3", [](auto&&...) {}, secOpts, "/self");
+  core.setCoalescingWindow(50_ms);
+
+  // Registration commands are logged by the face as well
+  auto nSyncInterests = [&face] {
+    return std::count_if(face.sentInterests.begin(), face.sentInterests.end(),
+                         [](const Interest& i) { return Name("/ndn/test3").isPrefixOf(i.getName()); });
+  };
+
+  // The first sync interest follows the registration of the prefix
+  advanceClocks(5_ms, 150_ms);
+  BOOST_REQUIRE_EQUAL(nSyncInterests(), 1);
+
+  // Updates within the window share one sync interest
+  core.updateSeqNo(1);
+  core.updateSeqNo(2);
+  core.updateSeqNo(3);
+  advanceClocks(5_ms, 45_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests(), 1);
+  advanceClocks(5_ms, 10_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests(), 2);
+
+  // Sync interests of peers within the window reset the periodic timer,
+  // but do not postpone the pending update
+  core.updateSeqNo(4);
+  advanceClocks(5_ms, 10_ms);
+  VersionVector peer;
+  peer.set("/self", 3);
+  peer.set("/peer", 1);
+  Interest interest(Name("/ndn/test3").appendVersion(2));
+  interest.setApplicationParameters(peer.encode());
+  core.onSyncInterestValidated(interest);
+  BOOST_CHECK_EQUAL(core.getSeqNo("/peer"), 1);
+  advanceClocks(5_ms, 30_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests(), 2);
+  advanceClocks(5_ms, 10_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests(), 3);
+
+  // Urgent updates are sent right away, by the thread of the face
+  std::thread publisher([&core] { core.updateSeqNo(5, SVSyncCore::EMPTY_NODE_ID, true); });
+  publisher.join();
+  BOOST_CHECK_EQUAL(nSyncInterests(), 3);
+  m_io.restart();
+  m_io.poll();
+  BOOST_CHECK_EQUAL(nSyncInterests(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(RateLimitSuppressed)
+{
+  util::DummyClientFace face(m_io, { true, true });
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSha256Signing();
+  SVSyncCore core(face, "/ndn/test3", [](auto&&...) {}, secOpts, "/self");
+  core.setSyncInterestRateLimit(1, 1);
+
+  auto nSyncInterests = [&face] {
+    return std::count_if(face.sentInterests.begin(), face.sentInterests.end(),
+                         [](const Interest& i) { return Name("/ndn/test3").isPrefixOf(i.getName()); });
+  };
+
+  // The first sync interest takes the token, which is back after a second
+  advanceClocks(5_ms, 150_ms);
+  BOOST_REQUIRE_EQUAL(nSyncInterests(), 1);
+  advanceClocks(100_ms, 1_s);
+
+  auto send = [&] {
+    core.retxSyncInterest(true, 0);
+    m_io.restart();
+    m_io.poll();
+  };
+
+  // A suppressed reply does not use up the token
+  core.enterSuppressionState(StateVectorView(core.getState()->encode()));
+  send();
+  BOOST_CHECK_EQUAL(nSyncInterests(), 1);
+  send();
+  BOOST_CHECK_EQUAL(nSyncInterests(), 2);
+
+  // Then the next one waits for the token
+  send();
+  BOOST_CHECK_EQUAL(nSyncInterests(), 2);
+  advanceClocks(100_ms, 1100_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(MergeFragment)
+{
+  // Restored entries are not recently updated after the suppression time
+  VersionVector local;
+  local.set("one", 1);
+  local.set("three", 3);
+  local.set("two", 2);
+  m_core.setState(VersionVector(local.encode()));
+  advanceClocks(1_s);
+
+  VersionVector other;
+  other.set("one", 1);
+  StateVectorView view(other.encode());
+
+  // "three" is absent and within the range of the fragment
+  SVSyncCore::FragmentRange range;
+  BOOST_CHECK(m_core.mergeStateVector(view, true, range).myVectorNew);
+
+  // "three" and "two" are outside the range
+  range.end = Name("three");
+  BOOST_CHECK(!m_core.mergeStateVector(view, true, range).myVectorNew);
+  BOOST_CHECK(!m_core.mergeStateVector(other, true, range).myVectorNew);
+
+  range.begin = Name("three");
+  range.end = std::nullopt;
+  BOOST_CHECK(range.contains("two"));
+  BOOST_CHECK(!range.contains("one"));
+  BOOST_CHECK(m_core.mergeStateVector(view, true, range).myVectorNew);
+}
+
+BOOST_AUTO_TEST_CASE(Fragments)
+{
+  VersionVector vv;
+  for (int i = 0; i < 100; i++)
+    vv.set(Name("/node").appendNumber(i), i + 1);
+
+  m_core.setMaxSyncParametersSize(300);
+  auto fragments = m_core.encodeSyncFragments(vv.encode(), Block(), false);
+  BOOST_CHECK_GT(fragments.size(), 1);
+
+  SVSyncCore receiver(m_face, "/ndn/test2", [](auto&&...) {});
+  for (const auto& params : fragments) {
+    BOOST_CHECK_LE(params.size(), 300);
+    params.parse();
+    BOOST_CHECK(params.find(svs::tlv::PartialStateVector) != params.elements_end());
+    BOOST_CHECK(params.find(svs::tlv::StateVectorFragment) != params.elements_end());
+
+    Interest interest(Name(m_syncPrefix).appendVersion(2));
+    interest.setApplicationParameters(params);
+    receiver.onSyncInterestValidated(interest);
+  }
+
+  // Each fragment is merged on arrival
+  BOOST_CHECK_EQUAL(receiver.getCounters().nSyncInterests, fragments.size());
+  BOOST_CHECK(receiver.getState()->encode() == vv.encode());
+
+  // A node missing at the sender is detected within its fragment, which
+  // puts the receiver into suppression state before it replies
+  VersionVector missing = vv;
+  missing.set(Name("/node").appendNumber(50).append("extra"), 1);
+  auto receiveAhead = [&](const std::string& prefix, const std::vector<Block>& received) {
+    auto ahead = std::make_unique<SVSyncCore>(m_face, prefix, [](auto&&...) {});
+    ahead->setState(VersionVector(missing.encode()));
+    advanceClocks(1_s);
+    for (const auto& params : received) {
+      Interest interest(Name(m_syncPrefix).appendVersion(2));
+      interest.setApplicationParameters(params);
+      ahead->onSyncInterestValidated(interest);
+    }
+    BOOST_CHECK_EQUAL(ahead->getCounters().nSyncInterests, received.size());
+    return ahead;
+  };
+
+  // Recording only succeeds in suppression state
+  StateVectorView empty(VersionVector().encode());
+  BOOST_CHECK(receiveAhead("/ndn/test3", fragments)->recordVector(empty));
+
+  // Without a FragmentIndex, the marker is ignored and the fragments are
+  // merged as partial vectors, whose absent entries are unknown
+  std::vector<Block> malformed;
+  for (const auto& params : fragments) {
+    params.parse();
+    auto marker = params.get(svs::tlv::StateVectorFragment);
+    marker.parse();
+    marker.remove(svs::tlv::FragmentIndex);
+    marker.encode();
+    auto vvWire = params.get(svs::tlv::StateVector);
+    malformed.push_back(m_core.encodeSyncParameters(vvWire, Block(), true, marker));
+  }
+  BOOST_CHECK(!receiveAhead("/ndn/test4", malformed)->recordVector(empty));
+}
+
+BOOST_AUTO_TEST_CASE(PruneInactiveMembers)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  VersionVector vv;
+  vv.set("/one", 5);
+  vv.set("/two", 3);
+  core.mergeStateVector(vv);
+  core.updateSeqNo(1);
+
+  // Nothing is pruned before the timeout
+  core.pruneInactiveMembers();
+  BOOST_CHECK_EQUAL(core.getState()->size(), 3);
+
+  // Handles of pruned members are released unless still in use
+  std::vector<NodeID> pruned;
+  core.setPruneCallback([&pruned](const NodeID& nid, NodeHandle) {
+    pruned.push_back(nid);
+    return nid != "/two";
+  });
+
+  advanceClocks(20_ms);
+  core.updateSeqNo(2);
+  core.pruneInactiveMembers();
+  BOOST_CHECK_EQUAL(core.getState()->size(), 1);
+  BOOST_CHECK_EQUAL(core.getCounters().nPrunedEntries, 2);
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 5);
+  BOOST_CHECK_EQUAL(pruned.size(), 2);
+  BOOST_CHECK(!core.getNodeIdRegistry()->find("/one"));
+  BOOST_CHECK(core.getNodeIdRegistry()->find("/two"));
+
+  // Stale vectors do not restore pruned entries
+  auto result = core.mergeStateVector(vv);
+  BOOST_CHECK(result.missingInfo.empty());
+  BOOST_CHECK(!core.getState()->has("/one"));
+
+  // Newer sequence numbers do, continuing from the tombstone
+  vv.set("/one", 7);
+  result = core.mergeStateVector(StateVectorView(vv.encode()));
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].nodeId, "/one");
+  BOOST_CHECK_EQUAL(result.missingInfo[0].low, 6);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].high, 7);
+  BOOST_CHECK_EQUAL(core.getState()->get("/one"), 7);
+  BOOST_CHECK(!core.getState()->has("/two"));
+}
+
+BOOST_AUTO_TEST_CASE(HandleReuse)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  VersionVector vv;
+  vv.set("/one", 5);
+  vv.set("/two", 3);
+  core.mergeStateVector(vv);
+  NodeHandle handleOne = *core.getNodeIdRegistry()->find("/one");
+  NodeHandle handleTwo = *core.getNodeIdRegistry()->find("/two");
+
+  // The handle of /two is still in use when it is pruned
+  core.setPruneCallback([](const NodeID& nid, NodeHandle) { return nid != "/two"; });
+  advanceClocks(20_ms);
+  core.pruneInactiveMembers();
+  BOOST_CHECK(!core.getState()->has("/one"));
+  BOOST_CHECK(!core.getState()->has("/two"));
+
+  // The released handle is assigned to the next new member, the other not
+  VersionVector newcomer;
+  newcomer.set("/three", 1);
+  auto result = core.mergeStateVector(newcomer);
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].nodeHandle, handleOne);
+
+  newcomer.set("/four", 1);
+  result = core.mergeStateVector(newcomer);
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].nodeId, "/four");
+  BOOST_CHECK_NE(result.missingInfo[0].nodeHandle, handleTwo);
+  BOOST_CHECK_EQUAL(core.getNodeIdRegistry()->getNodeId(handleTwo), "/two");
+}
+
+BOOST_AUTO_TEST_CASE(ExpiredTombstones)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 10_ms;
+  opts.tombstoneLifetime = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  VersionVector vv;
+  vv.set("/one", 5);
+  core.setState(VersionVector(vv.encode()));
+  m_core.setState(VersionVector(vv.encode()));
+
+  // Peers that pruned entries due for pruning are not answered with them
+  advanceClocks(1_s);
+  StateVectorView empty(VersionVector().encode());
+  BOOST_CHECK(!core.mergeStateVector(empty).myVectorNew);
+  BOOST_CHECK(m_core.mergeStateVector(empty).myVectorNew);
+
+  core.pruneInactiveMembers();
+  BOOST_CHECK(!core.getState()->has("/one"));
+
+  // After the lifetime, stale vectors restore the entry without its history
+  advanceClocks(20_ms);
+  vv.set("/one", 4);
+  auto result = core.mergeStateVector(vv);
+  BOOST_CHECK(result.missingInfo.empty());
+  BOOST_CHECK_EQUAL(core.getState()->get("/one"), 5);
+
+  // Later updates continue from the restored entry
+  vv.set("/one", 6);
+  result = core.mergeStateVector(vv);
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].low, 6);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].high, 6);
+}
+
+BOOST_AUTO_TEST_CASE(SweptTombstones)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 10_ms;
+  opts.tombstoneLifetime = 50_ms;
+  opts.periodicSyncTime = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  VersionVector vv;
+  vv.set("/one", 5);
+  core.setState(VersionVector(vv.encode()));
+
+  advanceClocks(20_ms);
+  core.pruneInactiveMembers();
+  BOOST_CHECK(!core.getState()->has("/one"));
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 5);
+
+  // Expired tombstones are kept for another lifetime
+  advanceClocks(60_ms);
+  core.pruneInactiveMembers();
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 5);
+
+  // Then they are swept, and the member is treated as new
+  advanceClocks(60_ms);
+  core.pruneInactiveMembers();
+  BOOST_CHECK_EQUAL(core.getSeqNo("/one"), 0);
+
+  vv.set("/one", 4);
+  auto result = core.mergeStateVector(vv);
+  BOOST_REQUIRE_EQUAL(result.missingInfo.size(), 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].low, 1);
+  BOOST_CHECK_EQUAL(result.missingInfo[0].high, 4);
+}
+
+BOOST_AUTO_TEST_CASE(PruneRestoredState)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 50_ms;
+  opts.periodicSyncTime = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  // Restored entries are pruned one timeout after the restore
+  advanceClocks(60_ms);
+  VersionVector vv;
+  vv.set("/one", 5);
+  core.setState(VersionVector(vv.encode()));
+  core.pruneInactiveMembers();
+  BOOST_CHECK(core.getState()->has("/one"));
+
+  advanceClocks(60_ms);
+  core.pruneInactiveMembers();
+  BOOST_CHECK(!core.getState()->has("/one"));
+}
+
+BOOST_AUTO_TEST_CASE(PruneLocalNodeIds)
+{
+  SyncCoreOptions opts;
+  opts.inactiveMemberTimeout = 10_ms;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/self", opts);
+
+  VersionVector vv;
+  vv.set("/peer", 2);
+  core.mergeStateVector(vv);
+  core.updateSeqNo(1);
+  core.updateSeqNo(3, "/self/stream");
+
+  // NodeIDs published by this node are kept, however long they are idle
+  advanceClocks(1_s);
+  StateVectorView empty(VersionVector().encode());
+  BOOST_CHECK(core.mergeStateVector(empty).myVectorNew);
+  core.pruneInactiveMembers();
+  BOOST_CHECK(!core.getState()->has("/peer"));
+  BOOST_CHECK_EQUAL(core.getSeqNo(), 1);
+  BOOST_CHECK_EQUAL(core.getSeqNo("/self/stream"), 3);
+  BOOST_CHECK_EQUAL(core.getCounters().nPrunedEntries, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Options)
+{
+  BOOST_CHECK_EQUAL(m_core.getPeriodicSyncTime().count(), 30000);
+
+  SyncCoreOptions opts;
+  opts.periodicSyncTime = 10_s;
+  SVSyncCore core(m_face, "/ndn/test2", [](auto&&...) {}, SecurityOptions::DEFAULT, "/one", opts);
+  BOOST_CHECK_EQUAL(core.getPeriodicSyncTime().count(), 10000);
+
+  opts.adaptivePeriodicSync = true;
+  opts.minPeriodicSyncTime = 20_s;
+  SVSyncCore adaptiveCore(m_face, "/ndn/test3", [](auto&&...) {}, SecurityOptions::DEFAULT, "/one", opts);
+  BOOST_CHECK_EQUAL(adaptiveCore.getPeriodicSyncTime().count(), 20000);
+
+  auto makeCore = [this](const SyncCoreOptions& opts) {
+    SVSyncCore core(m_face, "/ndn/test4", [](auto&&...) {}, SecurityOptions::DEFAULT, "/one", opts);
+  };
+
+  opts = {};
+  opts.periodicSyncJitter = 1.0;
+  BOOST_CHECK_THROW(makeCore(opts), SVSyncCore::Error);
+
+  opts = {};
+  opts.inactiveMemberTimeout = -1_ms;
+  BOOST_CHECK_THROW(makeCore(opts), SVSyncCore::Error);
+
+  opts = {};
+  opts.inactiveMemberTimeout = 10_s;
+  opts.tombstoneLifetime = 5_s;
+  BOOST_CHECK_THROW(makeCore(opts), SVSyncCore::Error);
+
+  opts = {};
+  opts.adaptivePeriodicSync = true;
+  opts.minPeriodicSyncTime = 200_s;
+  BOOST_CHECK_THROW(makeCore(opts), SVSyncCore::Error);
+
+  // HMAC signing works in either signed interest format, but needs a key
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  secOpts.interestSigner->signingInfo.setSignedInterestFormat(security::SignedInterestFormat::V02);
+  BOOST_CHECK_NO_THROW(SVSyncCore(m_face, "/ndn/test5", [](auto&&...) {}, secOpts, "/one"));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
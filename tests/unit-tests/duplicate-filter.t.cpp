@@ -0,0 +1,81 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "duplicate-filter.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <array>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestDuplicateFilter)
+
+static Name::Component
+makeDigest(uint8_t seed)
+{
+  std::array<uint8_t, 32> digest{};
+  digest.fill(seed);
+  return Name::Component(ndn::tlv::ParametersSha256DigestComponent, digest);
+}
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+  DuplicateFilter filter(1_s);
+  auto now = time::steady_clock::now();
+
+  BOOST_CHECK(!filter.isDuplicate(makeDigest(1), now));
+  BOOST_CHECK(!filter.isDuplicate(makeDigest(2), now));
+  BOOST_CHECK(filter.isDuplicate(makeDigest(1), now + 500_ms));
+  BOOST_CHECK(filter.isDuplicate(makeDigest(2), now + 500_ms));
+
+  // Forgotten after the lifetime
+  BOOST_CHECK(!filter.isDuplicate(makeDigest(1), now + 1_s));
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK(filter.isDuplicate(makeDigest(1), now + 1500_ms));
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  DuplicateFilter filter(10_s, 4);
+  auto now = time::steady_clock::now();
+
+  for (uint8_t i = 0; i < 6; i++)
+    BOOST_CHECK(!filter.isDuplicate(makeDigest(i), now));
+  BOOST_CHECK_EQUAL(filter.size(), 4);
+
+  // The oldest entries were evicted
+  BOOST_CHECK(filter.isDuplicate(makeDigest(5), now));
+  BOOST_CHECK(filter.isDuplicate(makeDigest(2), now));
+  BOOST_CHECK(!filter.isDuplicate(makeDigest(0), now));
+}
+
+BOOST_AUTO_TEST_CASE(NotDigest)
+{
+  DuplicateFilter filter;
+  Name::Component component("not-a-digest");
+
+  BOOST_CHECK(!filter.isDuplicate(component));
+  BOOST_CHECK(!filter.isDuplicate(component));
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,305 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#include "fetcher.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/clock-fixture.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <chrono>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+class FetcherFixture : public ClockFixture
+{
+protected:
+  FetcherFixture()
+    : m_face(m_io)
+    , m_fetcher(m_face, SecurityOptions::DEFAULT)
+  {
+  }
+
+  void fetch(const Name& name,
+             FetchPriority priority = FetchPriority::Normal,
+             const Name& producer = "/producer")
+  {
+    Interest interest(name);
+    interest.setInterestLifetime(2_s);
+    auto ignore = [](auto&&...) {};
+    m_fetcher.expressInterest(interest, ignore, ignore, ignore, 0, nullptr, producer, priority);
+    m_io.poll();
+  }
+
+  void reply(const Interest& interest)
+  {
+    Data data(interest.getName());
+    m_keyChain.sign(data, security::signingWithSha256());
+    m_face.receive(data);
+    m_io.poll();
+  }
+
+protected:
+  util::DummyClientFace m_face;
+  KeyChain m_keyChain{ "pib-memory:", "tpm-memory:" };
+  Fetcher m_fetcher;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFetcher, FetcherFixture)
+
+BOOST_AUTO_TEST_CASE(Window)
+{
+  for (int i = 0; i < 20; i++)
+    fetch(Name("/producer/data").appendNumber(i));
+
+  // The initial window limits the interests in flight
+  BOOST_CHECK_EQUAL(m_face.sentInterests.size(), 10);
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount(), 10);
+  BOOST_CHECK_EQUAL(m_fetcher.getQueueSize(), 10);
+
+  // Each Data grows the window in slow start
+  reply(m_face.sentInterests.front());
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/producer"), 11);
+  BOOST_CHECK_EQUAL(m_face.sentInterests.size(), 12);
+}
+
+BOOST_AUTO_TEST_CASE(PendingLimit)
+{
+  FetcherOptions options;
+  options.maxPending = 15;
+  Fetcher fetcher(m_face, SecurityOptions::DEFAULT, options);
+  auto ignore = [](auto&&...) {};
+  for (const Name producer : { "/a", "/b", "/c" }) {
+    for (int i = 0; i < 10; i++)
+      fetcher.expressInterest(Interest(Name(producer).appendNumber(i)), ignore, ignore, ignore, 0, nullptr,
+                              producer);
+  }
+  m_io.poll();
+
+  // The windows of the producers allow more than the fetcher as a whole
+  BOOST_CHECK_EQUAL(fetcher.getPendingCount(), 15);
+  BOOST_CHECK_EQUAL(m_face.sentInterests.size(), 15);
+  BOOST_CHECK_EQUAL(fetcher.getQueueSize(), 15);
+
+  options.maxPending = 0;
+  BOOST_CHECK_THROW(Fetcher(m_face, SecurityOptions::DEFAULT, options), Fetcher::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Priority)
+{
+  for (int i = 0; i < 15; i++)
+    fetch(Name("/producer/data").appendNumber(i));
+  fetch("/producer/low", FetchPriority::Low);
+  fetch("/producer/new", FetchPriority::High);
+  BOOST_CHECK_EQUAL(m_fetcher.getQueueSize(), 7);
+  BOOST_CHECK_EQUAL(m_fetcher.getQueueSize(FetchPriority::High), 1);
+
+  // Queued interests are sent by class, then in order
+  reply(m_face.sentInterests.front());
+  BOOST_REQUIRE_EQUAL(m_face.sentInterests.size(), 12);
+  BOOST_CHECK_EQUAL(m_face.sentInterests[10].getName(), "/producer/new");
+  BOOST_CHECK_EQUAL(m_face.sentInterests[11].getName(), Name("/producer/data").appendNumber(10));
+  BOOST_CHECK_EQUAL(m_fetcher.getQueueSize(FetchPriority::Low), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FairShare)
+{
+  // The shared limit binds before the windows of the producers
+  FetcherOptions options;
+  options.maxPending = 4;
+  Fetcher fetcher(m_face, SecurityOptions::DEFAULT, options);
+  auto fetchFrom = [&](const Name& producer, int i) {
+    Interest interest(Name(producer).append("data").appendNumber(i));
+    auto ignore = [](auto&&...) {};
+    fetcher.expressInterest(interest, ignore, ignore, ignore, 0, nullptr, producer);
+    m_io.poll();
+  };
+
+  for (int i = 0; i < 20; i++)
+    fetchFrom("/heavy", i);
+  fetchFrom("/light", 0);
+  fetchFrom("/light", 1);
+  BOOST_CHECK_EQUAL(m_face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(fetcher.getQueueSize("/heavy"), 16);
+  BOOST_CHECK_EQUAL(fetcher.getQueueSize("/light"), 2);
+
+  // Producers take turns instead of waiting for the heavy backlog
+  for (int i = 0; i < 4; i++)
+    reply(m_face.sentInterests[i]);
+  BOOST_REQUIRE_EQUAL(m_face.sentInterests.size(), 8);
+  BOOST_CHECK_EQUAL(m_face.sentInterests[4].getName(), Name("/heavy/data").appendNumber(4));
+  BOOST_CHECK_EQUAL(m_face.sentInterests[5].getName(), Name("/light/data").appendNumber(0));
+  BOOST_CHECK_EQUAL(m_face.sentInterests[6].getName(), Name("/heavy/data").appendNumber(5));
+  BOOST_CHECK_EQUAL(m_face.sentInterests[7].getName(), Name("/light/data").appendNumber(1));
+
+  auto depths = fetcher.getQueueDepths();
+  BOOST_CHECK_EQUAL(depths.size(), 1);
+  BOOST_CHECK_EQUAL(depths[Name("/heavy")], 14);
+  BOOST_CHECK_EQUAL(fetcher.getQueueSize("/light"), 0);
+
+  options.fairQuantum = 0;
+  BOOST_CHECK_THROW(Fetcher(m_face, SecurityOptions::DEFAULT, options), Fetcher::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SlotReuse)
+{
+  std::vector<std::string> events;
+  auto expressLogged = [&](const Name& name) {
+    m_fetcher.expressInterest(
+      Interest(name),
+      [&events, name](auto&&...) { events.push_back("data " + name.toUri()); },
+      [&events, name](auto&&...) { events.push_back("nack " + name.toUri()); },
+      [&events, name](auto&&...) { events.push_back("timeout " + name.toUri()); });
+    m_io.poll();
+  };
+
+  expressLogged("/producer/a");
+  lp::Nack nack(m_face.sentInterests.back());
+  nack.setReason(lp::NackReason::NO_ROUTE);
+  m_face.receive(nack);
+  m_io.poll();
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount(), 0);
+
+  // The slot of the completed fetch is used for the next one
+  expressLogged("/producer/b");
+  reply(m_face.sentInterests.back());
+  BOOST_REQUIRE_EQUAL(events.size(), 2);
+  BOOST_CHECK_EQUAL(events[0], "nack /producer/a");
+  BOOST_CHECK_EQUAL(events[1], "data /producer/b");
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IdleProducers)
+{
+  FetcherOptions options;
+  options.maxIdleProducers = 1;
+  // A single interest fills the window, which then grows on its Data
+  options.window.initialWindow = 1;
+  Fetcher fetcher(m_face, SecurityOptions::DEFAULT, options);
+  auto fetchFrom = [&](const Name& producer) {
+    auto ignore = [](auto&&...) {};
+    fetcher.expressInterest(Interest(Name(producer).append("data")), ignore, ignore, ignore, 0, nullptr,
+                            producer);
+    m_io.poll();
+  };
+
+  // Producers with interests in flight are kept, however many
+  fetchFrom("/a");
+  fetchFrom("/b");
+  fetchFrom("/c");
+  BOOST_CHECK_EQUAL(fetcher.getPendingCount(), 3);
+  BOOST_CHECK_EQUAL(fetcher.getPendingCount("/a"), 1);
+
+  // Idle producers keep their state up to the limit
+  reply(m_face.sentInterests[0]);
+  BOOST_CHECK_EQUAL(fetcher.getWindow("/a"), 2);
+  BOOST_CHECK(fetcher.getRto("/a"));
+
+  // The least recently used idle producer is forgotten
+  reply(m_face.sentInterests[1]);
+  BOOST_CHECK_EQUAL(fetcher.getWindow("/a"), 1);
+  BOOST_CHECK(!fetcher.getRto("/a"));
+  BOOST_CHECK_EQUAL(fetcher.getWindow("/b"), 2);
+
+  // New producers are tracked next to the idle one
+  fetchFrom("/d");
+  BOOST_CHECK_EQUAL(fetcher.getPendingCount("/d"), 1);
+  BOOST_CHECK_EQUAL(fetcher.getPendingCount("/c"), 1);
+  BOOST_CHECK_EQUAL(fetcher.getWindow("/b"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Rto)
+{
+  BOOST_CHECK(!m_fetcher.getRto("/producer"));
+
+  // The lifetime is kept until the RTT of the producer is known
+  fetch("/producer/data/1");
+  BOOST_REQUIRE_EQUAL(m_face.sentInterests.size(), 1);
+  BOOST_CHECK(m_face.sentInterests.back().getInterestLifetime() == 2_s);
+  reply(m_face.sentInterests.back());
+
+  auto rto = m_fetcher.getRto("/producer");
+  BOOST_REQUIRE(rto);
+  BOOST_CHECK(*rto < 2_s);
+
+  fetch("/producer/data/2");
+  BOOST_REQUIRE_EQUAL(m_face.sentInterests.size(), 2);
+  BOOST_CHECK(m_face.sentInterests.back().getInterestLifetime() < 2_s);
+  BOOST_CHECK(!m_fetcher.getRto("/other"));
+
+  // A timeout backs off the RTO and shrinks the window
+  advanceClocks(10_ms, std::chrono::ceil<time::milliseconds>(*rto) + 50_ms);
+  BOOST_CHECK(*m_fetcher.getRto("/producer") == 2 * *rto);
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/producer"), 5);
+
+  // Speculative interests keep their lifetime, and their timeouts are not losses
+  Interest interest("/producer/data/3");
+  interest.setInterestLifetime(20_ms);
+  auto ignore = [](auto&&...) {};
+  m_fetcher.expressInterest(interest, ignore, ignore, ignore, 0, nullptr, "/producer",
+                            FetchPriority::Low, true);
+  m_io.poll();
+  BOOST_REQUIRE_EQUAL(m_face.sentInterests.size(), 3);
+  BOOST_CHECK(m_face.sentInterests.back().getInterestLifetime() == 20_ms);
+
+  advanceClocks(10_ms, 30_ms);
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/producer"), 0);
+  BOOST_CHECK(*m_fetcher.getRto("/producer") == 2 * *rto);
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/producer"), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Timeouts)
+{
+  int nTimeouts = 0;
+  for (int i = 0; i < 10; i++) {
+    Interest interest(Name("/dead/data").appendNumber(i));
+    interest.setInterestLifetime(20_ms);
+    auto ignore = [](auto&&...) {};
+    m_fetcher.expressInterest(
+      interest, ignore, ignore, [&nTimeouts](auto&&...) { nTimeouts++; }, 2, nullptr, "/dead");
+  }
+  m_io.poll();
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/dead"), 10);
+
+  // The losses of one round trip shrink the window once
+  advanceClocks(10_ms, 30_ms);
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/dead"), 5);
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/dead"), 5);
+  BOOST_CHECK_EQUAL(m_fetcher.getQueueSize("/dead"), 5);
+
+  // Other producers keep their window
+  for (int i = 0; i < 10; i++)
+    fetch(Name("/alive/data").appendNumber(i), FetchPriority::Normal, "/alive");
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/alive"), 10);
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/alive"), 10);
+
+  // Lost retransmissions do not shrink the window again
+  for (int i = 0; i < 10 && nTimeouts < 10; i++)
+    advanceClocks(10_ms, 30_ms);
+  BOOST_CHECK_EQUAL(nTimeouts, 10);
+  BOOST_CHECK_EQUAL(m_fetcher.getWindow("/dead"), 5);
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/dead"), 0);
+  BOOST_CHECK_EQUAL(m_fetcher.getPendingCount("/alive"), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,143 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "hmac-context.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestHmacContext)
+
+static Interest
+makeInterest()
+{
+  Interest interest(Name("/ndn/test").appendVersion(2));
+  interest.setApplicationParameters(ndn::encoding::makeStringBlock(ndn::tlv::Content, "vector"));
+  return interest;
+}
+
+BOOST_AUTO_TEST_CASE(SignVerify)
+{
+  security::SigningInfo info;
+  info.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  info.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  HmacContext context(info);
+
+  auto interest = makeInterest();
+  BOOST_CHECK(!context.verify(interest));
+
+  context.sign(interest);
+  BOOST_CHECK(context.verify(interest));
+
+  // Decoded copy
+  BOOST_CHECK(context.verify(Interest(interest.wireEncode())));
+
+  // Different key
+  security::SigningInfo otherInfo;
+  otherInfo.setSigningHmacKey("YW5vdGhlciBzZWNyZXQgbWVzc2FnZQ==");
+  otherInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  BOOST_CHECK(!HmacContext(otherInfo).verify(interest));
+
+  // Modified parameters
+  interest.setApplicationParameters(ndn::encoding::makeStringBlock(ndn::tlv::Content, "other"));
+  BOOST_CHECK(!context.verify(interest));
+}
+
+BOOST_AUTO_TEST_CASE(KeyChainCompatible)
+{
+  security::SigningInfo info;
+  info.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  info.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  HmacContext context(info);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  auto interest = makeInterest();
+  keyChain.sign(interest, info);
+  BOOST_CHECK(context.verify(interest));
+
+  auto other = makeInterest();
+  context.sign(other);
+  BOOST_CHECK(
+    security::verifySignature(other, keyChain.getTpm(), info.getSignerName(), DigestAlgorithm::SHA256));
+}
+
+BOOST_AUTO_TEST_CASE(NoKey)
+{
+  BOOST_CHECK_THROW(HmacContext{ security::SigningInfo() }, HmacContext::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SignatureInfoFields)
+{
+  // Fields set on the signing info are signed, as with KeyChain::sign
+  security::SigningInfo info;
+  info.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  info.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  SignatureInfo sigInfo;
+  sigInfo.setTime(time::fromUnixTimestamp(time::milliseconds(1700000000000)));
+  sigInfo.setSeqNum(42);
+  info.setSignatureInfo(sigInfo);
+  HmacContext context(info);
+
+  auto interest = makeInterest();
+  context.sign(interest);
+  BOOST_REQUIRE(interest.getSignatureInfo());
+  BOOST_CHECK(interest.getSignatureInfo()->getTime() == sigInfo.getTime());
+  BOOST_CHECK(interest.getSignatureInfo()->getSeqNum() == sigInfo.getSeqNum());
+  BOOST_CHECK(context.verify(interest));
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto other = makeInterest();
+  keyChain.sign(other, info);
+  BOOST_CHECK(other.getSignatureValue() == interest.getSignatureValue());
+}
+
+BOOST_AUTO_TEST_CASE(SignedInterestV02)
+{
+  // The v0.2 format, the SigningInfo default, is signed through a KeyChain
+  security::SigningInfo info;
+  info.setSigningHmacKey("dGhpcyBpcyBhIHNlY3JldCBtZXNzYWdl");
+  BOOST_REQUIRE(info.getSignedInterestFormat() == security::SignedInterestFormat::V02);
+  HmacContext context(info);
+
+  auto interest = makeInterest();
+  BOOST_CHECK(!context.verify(interest));
+  context.sign(interest);
+  BOOST_CHECK(!interest.getSignatureInfo());
+  BOOST_CHECK(context.verify(interest));
+  BOOST_CHECK(context.verify(Interest(interest.wireEncode())));
+
+  // Interoperable with KeyChain::sign in the same format
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto other = makeInterest();
+  keyChain.sign(other, info);
+  BOOST_CHECK(context.verify(other));
+
+  // Different key
+  security::SigningInfo otherInfo;
+  otherInfo.setSigningHmacKey("YW5vdGhlciBzZWNyZXQgbWVzc2FnZQ==");
+  BOOST_CHECK(!HmacContext(otherInfo).verify(interest));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,77 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "node-id-registry.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestNodeIdRegistry)
+
+BOOST_AUTO_TEST_CASE(Intern)
+{
+  NodeIdRegistry registry;
+
+  NodeHandle one = registry.intern("/one");
+  NodeHandle two = registry.intern("/two");
+  BOOST_CHECK_EQUAL(one, 0);
+  BOOST_CHECK_EQUAL(two, 1);
+  BOOST_CHECK_EQUAL(registry.intern("/one"), one);
+  BOOST_CHECK_EQUAL(registry.size(), 2);
+
+  BOOST_CHECK_EQUAL(registry.getNodeId(one), "/one");
+  BOOST_CHECK_EQUAL(registry.getNodeId(two), "/two");
+  BOOST_CHECK_THROW(registry.getNodeId(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  NodeIdRegistry registry;
+  registry.intern("/one");
+
+  BOOST_REQUIRE(registry.find("/one").has_value());
+  BOOST_CHECK_EQUAL(*registry.find("/one"), 0);
+  BOOST_CHECK(!registry.find("/two").has_value());
+  BOOST_CHECK_EQUAL(registry.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Release)
+{
+  NodeIdRegistry registry;
+  NodeHandle one = registry.intern("/one");
+  registry.intern("/two");
+
+  BOOST_CHECK(registry.release(one));
+  BOOST_CHECK(!registry.release(one));
+  BOOST_CHECK(!registry.release(5));
+  BOOST_CHECK_EQUAL(registry.size(), 1);
+  BOOST_CHECK(!registry.find("/one").has_value());
+  BOOST_CHECK_THROW(registry.getNodeId(one), std::out_of_range);
+
+  // Released handles are assigned again
+  BOOST_CHECK_EQUAL(registry.intern("/three"), one);
+  BOOST_CHECK_EQUAL(registry.getNodeId(one), "/three");
+  BOOST_CHECK_EQUAL(registry.intern("/one"), 2);
+  BOOST_CHECK_EQUAL(registry.size(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
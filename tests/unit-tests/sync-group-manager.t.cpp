@@ -0,0 +1,175 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+#include "sync-group-manager.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/clock-fixture.hpp"
+
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestSyncGroupManager)
+
+BOOST_AUTO_TEST_CASE(AddRemove)
+{
+  Face face;
+  SyncGroupManager manager(face, "/ndn/docs");
+
+  auto& one = manager.addGroup("/ndn/docs/one", [](auto&&...) {});
+  manager.addGroup("/ndn/docs/two", [](auto&&...) {});
+  BOOST_CHECK_EQUAL(manager.size(), 2);
+  BOOST_CHECK_EQUAL(manager.findGroup("/ndn/docs/one"), &one);
+  BOOST_CHECK(&one.getScheduler() == &manager.getScheduler());
+
+  BOOST_CHECK_THROW(manager.addGroup("/ndn/docs/one", [](auto&&...) {}), SyncGroupManager::Error);
+  BOOST_CHECK_THROW(manager.addGroup("/ndn/other", [](auto&&...) {}), SyncGroupManager::Error);
+
+  BOOST_CHECK(manager.removeGroup("/ndn/docs/one"));
+  BOOST_CHECK(!manager.removeGroup("/ndn/docs/one"));
+  BOOST_CHECK(manager.findGroup("/ndn/docs/one") == nullptr);
+  BOOST_CHECK_EQUAL(manager.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Dispatch)
+{
+  Face face;
+  SyncGroupManager manager(face, "/ndn/docs");
+
+  std::vector<MissingDataInfo> updates;
+  auto& one = manager.addGroup("/ndn/docs/one", [&](const auto& info) { updates = info; });
+  auto& two = manager.addGroup("/ndn/docs/two", [](auto&&...) {});
+
+  VersionVector vv;
+  vv.set("/node", 3);
+  Interest interest(Name("/ndn/docs/one").appendVersion(2));
+  interest.setApplicationParameters(vv.encode());
+  manager.onSyncInterest(interest);
+
+  BOOST_CHECK_EQUAL(one.getSeqNo("/node"), 3);
+  BOOST_CHECK_EQUAL(two.getSeqNo("/node"), 0);
+  BOOST_REQUIRE_EQUAL(updates.size(), 1);
+  BOOST_CHECK_EQUAL(updates[0].nodeId, "/node");
+
+  // Interests of unknown groups are ignored
+  Interest unknown(Name("/ndn/docs/three").appendVersion(2));
+  unknown.setApplicationParameters(vv.encode());
+  manager.onSyncInterest(unknown);
+  BOOST_CHECK_EQUAL(one.getCounters().nSyncInterests, 1);
+  BOOST_CHECK_EQUAL(two.getCounters().nSyncInterests, 0);
+
+  // Signature components of v0.2 signed interests follow the digest
+  vv.set("/node", 4);
+  Interest signedV02(Name("/ndn/docs/two").appendVersion(2));
+  signedV02.setApplicationParameters(vv.encode());
+  signedV02.setName(Name(signedV02.getName()).append("signature-info").append("signature-value"));
+  manager.onSyncInterest(signedV02);
+  BOOST_CHECK_EQUAL(two.getSeqNo("/node"), 4);
+  BOOST_CHECK_EQUAL(one.getSeqNo("/node"), 3);
+}
+
+BOOST_AUTO_TEST_CASE(NestedGroups)
+{
+  Face face;
+  SyncGroupManager manager(face, "/ndn/docs");
+
+  auto& outer = manager.addGroup("/ndn/docs/one", [](auto&&...) {});
+  auto& inner = manager.addGroup("/ndn/docs/one/sub", [](auto&&...) {});
+
+  // Interests go to the longest prefix followed by a version
+  VersionVector vv;
+  vv.set("/node", 2);
+  Interest interest(Name("/ndn/docs/one/sub").appendVersion(2));
+  interest.setApplicationParameters(vv.encode());
+  manager.onSyncInterest(interest);
+  BOOST_CHECK_EQUAL(inner.getSeqNo("/node"), 2);
+  BOOST_CHECK_EQUAL(outer.getSeqNo("/node"), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(RemoveBeforeStart, ClockFixture)
+{
+  util::DummyClientFace face(m_io, { true, true });
+  SyncGroupManager manager(face, "/ndn/docs");
+  advanceClocks(10_ms);
+
+  auto nSyncInterests = [&face](const Name& syncPrefix) {
+    return std::count_if(face.sentInterests.begin(), face.sentInterests.end(),
+                         [&](const Interest& i) { return syncPrefix.isPrefixOf(i.getName()); });
+  };
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSha256Signing();
+
+  // The first sync interest of a removed group is never sent
+  manager.addGroup("/ndn/docs/one", [](auto&&...) {}, secOpts, "/self");
+  manager.addGroup("/ndn/docs/two", [](auto&&...) {}, secOpts, "/self");
+  advanceClocks(10_ms);
+  BOOST_CHECK(manager.removeGroup("/ndn/docs/one"));
+  advanceClocks(10_ms, 20);
+
+  BOOST_CHECK_EQUAL(nSyncInterests("/ndn/docs/one"), 0);
+  BOOST_CHECK_EQUAL(nSyncInterests("/ndn/docs/two"), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(UpdateFromOtherThread, ClockFixture)
+{
+  util::DummyClientFace face(m_io, { true, true });
+  SyncGroupManager manager(face, "/ndn/docs");
+
+  auto nSyncInterests = [&face](const Name& syncPrefix) {
+    return std::count_if(face.sentInterests.begin(), face.sentInterests.end(),
+                         [&](const Interest& i) { return syncPrefix.isPrefixOf(i.getName()); });
+  };
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SecurityOptions secOpts(keyChain);
+  secOpts.interestSigner->signingInfo.setSha256Signing();
+
+  auto& one = manager.addGroup("/ndn/docs/one", [](auto&&...) {}, secOpts, "/self");
+  auto& two = manager.addGroup("/ndn/docs/two", [](auto&&...) {}, secOpts, "/self");
+  one.setCoalescingWindow(50_ms);
+  two.setCoalescingWindow(50_ms);
+  advanceClocks(5_ms, 150_ms);
+  BOOST_REQUIRE_EQUAL(nSyncInterests("/ndn/docs/one"), 1);
+  BOOST_REQUIRE_EQUAL(nSyncInterests("/ndn/docs/two"), 1);
+
+  // The shared scheduler is only used by the thread of the face
+  std::thread publisher([&] {
+    for (SeqNo seq = 1; seq <= 10; ++seq) {
+      one.updateSeqNo(seq);
+      two.updateSeqNo(seq);
+    }
+  });
+  publisher.join();
+  BOOST_CHECK_EQUAL(one.getSeqNo("/self"), 10);
+  BOOST_CHECK_EQUAL(two.getSeqNo("/self"), 10);
+
+  advanceClocks(5_ms, 60_ms);
+  BOOST_CHECK_EQUAL(nSyncInterests("/ndn/docs/one"), 2);
+  BOOST_CHECK_EQUAL(nSyncInterests("/ndn/docs/two"), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -0,0 +1,109 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "token-bucket.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestTokenBucket)
+
+BOOST_AUTO_TEST_CASE(Unlimited)
+{
+  TokenBucket bucket;
+  BOOST_CHECK(!bucket.isLimited());
+  for (int i = 0; i < 1000; i++)
+    BOOST_CHECK_EQUAL(bucket.take().count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Limited)
+{
+  // 10 tokens per second, bursts of 3
+  TokenBucket bucket(10, 3);
+  BOOST_CHECK(bucket.isLimited());
+
+  auto now = time::steady_clock::now();
+  for (int i = 0; i < 3; i++)
+    BOOST_CHECK_EQUAL(bucket.take(now).count(), 0);
+
+  // Empty; the next token is 100 ms away
+  auto wait = bucket.take(now);
+  BOOST_CHECK(wait > 99_ms);
+  BOOST_CHECK(wait <= 101_ms);
+
+  now += 50_ms;
+  BOOST_CHECK(bucket.take(now) > 49_ms);
+
+  now += 50_ms;
+  BOOST_CHECK_EQUAL(bucket.take(now).count(), 0);
+  BOOST_CHECK_GT(bucket.take(now).count(), 0);
+
+  // Refill does not exceed the burst size
+  now += 10_s;
+  for (int i = 0; i < 3; i++)
+    BOOST_CHECK_EQUAL(bucket.take(now).count(), 0);
+  BOOST_CHECK_GT(bucket.take(now).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(WaitTime)
+{
+  TokenBucket bucket(10, 1);
+  auto now = time::steady_clock::now();
+
+  // Looking does not take the token
+  BOOST_CHECK_EQUAL(bucket.getWaitTime(now).count(), 0);
+  BOOST_CHECK_EQUAL(bucket.getWaitTime(now).count(), 0);
+  BOOST_CHECK_EQUAL(bucket.take(now).count(), 0);
+
+  auto wait = bucket.getWaitTime(now);
+  BOOST_CHECK(wait > 99_ms);
+  BOOST_CHECK(wait <= 101_ms);
+  BOOST_CHECK(bucket.take(now) == wait);
+
+  BOOST_CHECK_EQUAL(TokenBucket().getWaitTime(now).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Charge)
+{
+  TokenBucket bucket(10, 2);
+  auto now = time::steady_clock::now();
+
+  // Charging an empty bucket puts it into debt
+  bucket.charge(1, now);
+  bucket.charge(3, now);
+  auto wait = bucket.take(now);
+  BOOST_CHECK(wait > 299_ms);
+  BOOST_CHECK(wait <= 301_ms);
+
+  // The debt is repaid at the configured rate
+  now += 200_ms;
+  BOOST_CHECK(bucket.take(now) > 99_ms);
+  now += 100_ms;
+  BOOST_CHECK_EQUAL(bucket.take(now).count(), 0);
+
+  // No effect without a limit
+  TokenBucket unlimited;
+  unlimited.charge(100, now);
+  BOOST_CHECK_EQUAL(unlimited.take(now).count(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
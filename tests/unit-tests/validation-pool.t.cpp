@@ -0,0 +1,98 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2012-2025 University of California, Los Angeles
+ *
+ * This file is part of ndn-svs, synchronization library for distributed realtime
+ * applications for NDN.
+ *
+ * ndn-svs library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, in version 2.1 of the License.
+ *
+ * ndn-svs library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+ */
+
+
+#include "validation-pool.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <future>
+
+namespace ndn::tests {
+
+using namespace ndn::svs;
+
+BOOST_AUTO_TEST_SUITE(TestValidationPool)
+
+BOOST_AUTO_TEST_CASE(RunTasks)
+{
+  ValidationPool pool(4, 100);
+
+  std::atomic<int> count = 0;
+  std::promise<void> done;
+  for (int i = 0; i < 50; i++) {
+    pool.post([&] {
+      if (++count == 50)
+        done.set_value();
+    });
+  }
+
+  BOOST_REQUIRE(done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+  BOOST_CHECK_EQUAL(count, 50);
+  BOOST_CHECK_EQUAL(pool.getDropped(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DropOldest)
+{
+  ValidationPool pool(1, 2);
+
+  // Keep the only thread busy
+  std::promise<void> started, release;
+  pool.post([&] {
+    started.set_value();
+    release.get_future().wait();
+  });
+  started.get_future().wait();
+
+  std::mutex mutex;
+  std::vector<int> executed;
+  std::promise<void> done;
+  for (int i = 0; i < 4; i++) {
+    pool.post([&, i] {
+      std::lock_guard<std::mutex> lock(mutex);
+      executed.push_back(i);
+      if (i == 3)
+        done.set_value();
+    });
+  }
+  BOOST_CHECK_EQUAL(pool.getDropped(), 2);
+
+  release.set_value();
+  BOOST_REQUIRE(done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  BOOST_CHECK_EQUAL(executed.size(), 2);
+  BOOST_CHECK_EQUAL(executed.at(0), 2);
+  BOOST_CHECK_EQUAL(executed.at(1), 3);
+}
+
+BOOST_AUTO_TEST_CASE(FailedTasks)
+{
+  ValidationPool pool(1, 10);
+
+  // Exceptions are counted and do not stop the thread
+  std::promise<void> done;
+  pool.post([] { throw std::runtime_error("malformed"); });
+  pool.post([&] { done.set_value(); });
+
+  BOOST_REQUIRE(done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+  BOOST_CHECK_EQUAL(pool.getFailed(), 1);
+  BOOST_CHECK_EQUAL(pool.getDropped(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn::tests
@@ -15,6 +15,7 @@
  */
 
 #include "version-vector.hpp"
+#include "compact-state-vector.hpp"
 #include "tlv.hpp"
 
 #include "tests/boost-test.hpp"
@@ -51,6 +52,20 @@ BOOST_AUTO_TEST_CASE(Set)
   BOOST_CHECK_EQUAL(v.get("four"), 44);
 }
 
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  uint64_t digest = v.getDigest();
+  Block wire = v.encode();
+  v.set("three", 3);
+
+  BOOST_CHECK(v.erase("three"));
+  BOOST_CHECK(!v.erase("three"));
+  BOOST_CHECK(!v.has("three"));
+  BOOST_CHECK_EQUAL(v.size(), 2);
+  BOOST_CHECK_EQUAL(v.getDigest(), digest);
+  BOOST_CHECK(v.encode() == wire);
+}
+
 BOOST_AUTO_TEST_CASE(Iterate)
 {
   std::unordered_map<NodeID, SeqNo> umap;
@@ -73,6 +88,95 @@ BOOST_AUTO_TEST_CASE(EncodeDecode)
   BOOST_CHECK_EQUAL(dv.get("two"), 2);
 }
 
+BOOST_AUTO_TEST_CASE(EncodeAfterUpdate)
+{
+  Block before = v.encode();
+  BOOST_CHECK(v.encode() == before);
+
+  // Cached encodings are the same as fresh ones
+  v.cacheEncoding();
+  BOOST_CHECK(v.encode() == before);
+
+  v.set("two", 22);
+  v.set("three", 3);
+
+  VersionVector fresh;
+  fresh.set("three", 3);
+  fresh.set("two", 22);
+  fresh.set("one", 1);
+
+  Block after = v.encode();
+  Block expected = fresh.encode();
+  BOOST_CHECK(after != before);
+  BOOST_CHECK_EQUAL_COLLECTIONS(after.begin(), after.end(), expected.begin(), expected.end());
+
+  VersionVector dv(after);
+  BOOST_CHECK_EQUAL(dv.get("one"), 1);
+  BOOST_CHECK_EQUAL(dv.get("two"), 22);
+  BOOST_CHECK_EQUAL(dv.get("three"), 3);
+}
+
+BOOST_AUTO_TEST_CASE(CopyOnWrite)
+{
+  // Insert out of order, so that chunks are split in the middle
+  VersionVector large;
+  auto node = [](int i) { return Name("/node").appendNumber(i); };
+  for (int i = 0; i < 1000; i++)
+    large.set(node((i * 7919) % 1000), (i * 7919) % 1000 + 1);
+  BOOST_CHECK_EQUAL(large.size(), 1000);
+  large.cacheEncoding();
+
+  VersionVector copy = large;
+  const VersionVector::Entry* first = &*copy.begin();
+  const VersionVector::Entry* last = &*std::prev(copy.end());
+  BOOST_CHECK_EQUAL(first, &*large.begin());
+
+  // Updates and erasures do not affect the copy
+  large.set(node(999), 5000);
+  BOOST_CHECK(large.erase(node(500)));
+  large.set("/zzzzz", 1);
+  BOOST_CHECK_EQUAL(large.get(node(999)), 5000);
+  BOOST_CHECK_EQUAL(copy.get(node(999)), 1000);
+  BOOST_CHECK(!large.has(node(500)));
+  BOOST_CHECK_EQUAL(copy.get(node(500)), 501);
+  BOOST_CHECK(!copy.has("/zzzzz"));
+  BOOST_CHECK_EQUAL(copy.size(), 1000);
+  BOOST_CHECK_EQUAL(large.size(), 1000);
+
+  // Only the modified chunks were cloned
+  BOOST_CHECK_EQUAL(&*copy.begin(), first);
+  BOOST_CHECK_EQUAL(&*large.begin(), first);
+  BOOST_CHECK_NE(&*std::prev(large.end()), last);
+
+  // Iteration stays sorted across chunks, in both directions
+  size_t n = 0;
+  for (auto it = large.begin(); std::next(it) != large.end(); ++it, n++)
+    BOOST_CHECK(it->first < std::next(it)->first);
+  BOOST_CHECK_EQUAL(n + 1, large.size());
+  BOOST_CHECK_EQUAL(std::prev(large.end())->first, Name("/zzzzz"));
+
+  // Both encode to what they hold
+  VersionVector decoded(large.encode());
+  BOOST_CHECK_EQUAL(decoded.size(), 1000);
+  BOOST_CHECK_EQUAL(decoded.get(node(999)), 5000);
+  BOOST_CHECK_EQUAL(decoded.getDigest(), large.getDigest());
+  BOOST_CHECK_EQUAL(VersionVector(copy.encode()).getDigest(), copy.getDigest());
+}
+
+BOOST_AUTO_TEST_CASE(EncodeRecent)
+{
+  // Decoded entries have no local update time
+  VersionVector dv(v.encode());
+  dv.set("three", 3);
+
+  VersionVector recent(dv.encodeRecent(1));
+  BOOST_CHECK_EQUAL(recent.size(), 1);
+  BOOST_CHECK_EQUAL(recent.get("three"), 3);
+
+  VersionVector all(dv.encodeRecent(5));
+  BOOST_CHECK_EQUAL(all.size(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(DecodeStatic)
 {
   // Hex: CA0A070508036F6E65CC0101CA0A0705080374776FCC0102
@@ -101,6 +205,176 @@ BOOST_AUTO_TEST_CASE(Ordering)
   BOOST_CHECK_EQUAL(v1str, v2str);
 }
 
+BOOST_AUTO_TEST_CASE(View)
+{
+  VersionVector v1;
+  v1.set("one", 1);
+  v1.set("two", 2);
+  v1.set("/one/a", 3);
+
+  StateVectorView view(v1.encode());
+  BOOST_CHECK_EQUAL(view.size(), 3);
+  BOOST_CHECK(view.isSorted());
+  BOOST_CHECK_EQUAL(view.get("one"), 1);
+  BOOST_CHECK_EQUAL(view.get("two"), 2);
+  BOOST_CHECK_EQUAL(view.get("/one/a"), 3);
+  BOOST_CHECK_EQUAL(view.get("three"), 0);
+
+  // Iteration order is the same as the decoded vector
+  auto it = v1.begin();
+  for (const auto& entry : view) {
+    BOOST_CHECK_EQUAL(entry.getNodeId(), it->first);
+    BOOST_CHECK_EQUAL(entry.seqNo, it->second);
+    BOOST_CHECK_EQUAL(v.get(entry), v.get(it->first));
+    ++it;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ViewUnsorted)
+{
+  // "two" is encoded before "one"
+  constexpr std::string_view encoded{ "\xCA\x0A\x07\x05\x08\x03\x74\x77\x6F\xCC\x01\x02"
+                                      "\xCA\x0A\x07\x05\x08\x03\x6F\x6E\x65\xCC\x01\x01" };
+  StateVectorView view(ndn::encoding::makeStringBlock(svs::tlv::StateVector, encoded));
+  BOOST_CHECK(!view.isSorted());
+  BOOST_CHECK_EQUAL(view.get("one"), 1);
+  BOOST_CHECK_EQUAL(view.get("two"), 2);
+
+  VersionVector dv(view);
+  BOOST_CHECK_EQUAL(dv.begin()->first, "one");
+}
+
+BOOST_AUTO_TEST_CASE(ViewMalformed)
+{
+  // Truncated entry
+  constexpr std::string_view truncated{ "\xCA\x0A\x07\x05\x08\x03\x6F\x6E\x65\xCC\x01" };
+  BOOST_CHECK_THROW(StateVectorView(ndn::encoding::makeStringBlock(svs::tlv::StateVector, truncated)),
+                    ndn::tlv::Error);
+
+  // Missing SeqNo
+  constexpr std::string_view noSeq{ "\xCA\x07\x07\x05\x08\x03\x6F\x6E\x65" };
+  BOOST_CHECK_THROW(StateVectorView(ndn::encoding::makeStringBlock(svs::tlv::StateVector, noSeq)),
+                    ndn::tlv::Error);
+
+  // Wrong outer type
+  BOOST_CHECK_THROW(StateVectorView(ndn::encoding::makeStringBlock(svs::tlv::StateVectorEntry, "")),
+                    ndn::tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Digest)
+{
+  VersionVector v1;
+  BOOST_CHECK_EQUAL(v1.getDigest(), 0);
+  v1.set("one", 1);
+  v1.set("two", 2);
+
+  // Same as the view of the encoding, and of an unsorted encoding
+  BOOST_CHECK_EQUAL(StateVectorView(v1.encode()).getDigest(), v1.getDigest());
+  constexpr std::string_view unsorted{ "\xCA\x0A\x07\x05\x08\x03\x74\x77\x6F\xCC\x01\x02"
+                                       "\xCA\x0A\x07\x05\x08\x03\x6F\x6E\x65\xCC\x01\x01" };
+  StateVectorView view(ndn::encoding::makeStringBlock(svs::tlv::StateVector, unsorted));
+  BOOST_CHECK_EQUAL(view.getDigest(), v1.getDigest());
+
+  // Updated in place
+  uint64_t before = v1.getDigest();
+  v1.set("two", 3);
+  BOOST_CHECK_NE(v1.getDigest(), before);
+  VersionVector v2;
+  v2.set("two", 3);
+  v2.set("one", 1);
+  BOOST_CHECK_EQUAL(v1.getDigest(), v2.getDigest());
+
+  v1.set("two", 2);
+  BOOST_CHECK_EQUAL(v1.getDigest(), before);
+
+  // Swapping sequence numbers changes the digest
+  VersionVector v3;
+  v3.set("one", 2);
+  v3.set("two", 1);
+  BOOST_CHECK_NE(v3.getDigest(), before);
+}
+
+BOOST_AUTO_TEST_CASE(Compact)
+{
+  VersionVector v1;
+  v1.set("/org/site/alice", 1);
+  v1.set("/org/site/bob", 300);
+  v1.set("/org/site/bob/phone", 70000);
+  v1.set("/other", 2);
+  v1.set("/", 5);
+
+  auto wire = v1.encode();
+  auto compact = encodeCompactStateVector(StateVectorView(wire));
+  BOOST_CHECK_EQUAL(compact.type(), svs::tlv::CompactStateVector);
+  BOOST_CHECK_LT(compact.size(), wire.size());
+
+  // Expansion gives back the same StateVector encoding
+  auto expanded = expandCompactStateVector(compact);
+  BOOST_CHECK_EQUAL_COLLECTIONS(expanded.begin(), expanded.end(), wire.begin(), wire.end());
+
+  VersionVector dv(expanded);
+  BOOST_CHECK_EQUAL(dv.size(), 5);
+  BOOST_CHECK_EQUAL(dv.get("/org/site/bob/phone"), 70000);
+  BOOST_CHECK_EQUAL(dv.get("/"), 5);
+
+  // Sequence numbers are sent as differences to the smallest one
+  VersionVector v2;
+  for (int i = 0; i < 100; i++)
+    v2.set(Name("/node").appendNumber(i), 70000 + i);
+  wire = v2.encode();
+  compact = encodeCompactStateVector(StateVectorView(wire));
+  VersionVector v3;
+  for (int i = 0; i < 100; i++)
+    v3.set(Name("/node").appendNumber(i), i);
+  BOOST_CHECK_LE(compact.size(), encodeCompactStateVector(StateVectorView(v3.encode())).size() + 5);
+  expanded = expandCompactStateVector(compact);
+  BOOST_CHECK_EQUAL_COLLECTIONS(expanded.begin(), expanded.end(), wire.begin(), wire.end());
+
+  // Empty vector
+  auto empty = expandCompactStateVector(encodeCompactStateVector(StateVectorView(VersionVector().encode())));
+  BOOST_CHECK_EQUAL(StateVectorView(empty).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CompactMalformed)
+{
+  using namespace std::string_view_literals;
+  auto expand = [](std::string_view value) {
+    return expandCompactStateVector(ndn::encoding::makeStringBlock(svs::tlv::CompactStateVector, value));
+  };
+
+  // Shared prefix without a previous entry
+  constexpr auto noPrev = "\x00\x01\x05\x08\x03\x6F\x6E\x65\x01"sv;
+  BOOST_CHECK_THROW(expand(noPrev), ndn::tlv::Error);
+
+  // Truncated suffix
+  constexpr auto truncated = "\x00\x00\x05\x08\x03\x6F"sv;
+  BOOST_CHECK_THROW(expand(truncated), ndn::tlv::Error);
+
+  // Missing SeqNo
+  constexpr auto noSeq = "\x00\x00\x05\x08\x03\x6F\x6E\x65"sv;
+  BOOST_CHECK_THROW(expand(noSeq), ndn::tlv::Error);
+
+  // SeqNo beyond the range of the base
+  constexpr auto overflow = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x00\x05\x08\x03\x6F\x6E\x65\x01"sv;
+  BOOST_CHECK_THROW(expand(overflow), ndn::tlv::Error);
+
+  // Wrong outer type
+  BOOST_CHECK_THROW(expandCompactStateVector(ndn::encoding::makeStringBlock(svs::tlv::StateVector, "")),
+                    ndn::tlv::Error);
+
+  // Every entry repeats the whole previous NodeID, so a few KB expand quadratically
+  constexpr size_t nComponents = 1000;
+  auto varNumber = [](size_t n) { return std::string{ '\xFD', char(n >> 8), char(n & 0xFF) }; };
+  std::string bomb = std::string(2, '\x00') + varNumber(nComponents * 3);
+  for (size_t i = 0; i < nComponents; i++)
+    bomb += "\x08\x01\x61";
+  bomb += "\x01";
+  for (size_t i = 0; i < nComponents; i++)
+    bomb += varNumber(nComponents + i) + "\x03\x08\x01\x61\x01";
+  BOOST_CHECK_LT(bomb.size(), 10000);
+  BOOST_CHECK_THROW(expand(bomb), ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn::tests